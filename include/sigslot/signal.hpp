@@ -1,9 +1,21 @@
 #pragma once
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <exception>
+#include <functional>
+#include <initializer_list>
 #include <memory>
 #include <mutex>
+#include <new>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <thread>
 #include <vector>
@@ -13,11 +25,28 @@
 #include <typeinfo>
 #endif
 
+#if defined(__has_include) && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+#if __has_include(<memory_resource>)
+#define SIGSLOT_PMR_ENABLED 1
+#include <memory_resource>
+#endif
+#endif
+
+#if defined(__has_include) && (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L))
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine)
+#define SIGSLOT_COROUTINES_ENABLED 1
+#include <coroutine>
+#include <optional>
+#endif
+#endif
+
 namespace sigslot {
 
 template <typename, typename...>
 class signal_base;
 
+class trackable;
+
 namespace detail {
 
 // Used to detect an object of observer type
@@ -93,6 +122,14 @@ template <typename T>
 struct is_weak_ptr_compatible<T, void_t<decltype(to_weak(std::declval<T>()))>>
     : is_weak_ptr<decltype(to_weak(std::declval<T>()))> {};
 
+template <typename, typename, typename, typename = void>
+struct is_callable_r : std::false_type {};
+
+template <typename R, typename F, typename... T>
+struct is_callable_r<R, F, typelist<T...>,
+        void_t<decltype(std::declval<F>()(std::declval<T>()...))>>
+    : std::is_convertible<decltype(std::declval<F>()(std::declval<T>()...)), R> {};
+
 template <typename...>
 struct is_signal : std::false_type {};
 
@@ -117,6 +154,10 @@ constexpr bool is_weak_ptr_compatible_v = detail::is_weak_ptr_compatible<std::de
 template <typename L, typename... T>
 constexpr bool is_callable_v = detail::is_callable<T..., L>::value;
 
+/// determine if a callable returns a type convertible to R with supplied arguments
+template <typename R, typename L, typename F>
+constexpr bool is_callable_r_v = detail::is_callable_r<R, F, L>::value;
+
 template <typename T>
 constexpr bool is_weak_ptr_v = detail::is_weak_ptr<T>::value;
 
@@ -136,6 +177,12 @@ template <typename T>
 constexpr bool is_observer_v = std::is_base_of<::sigslot::detail::observer_type,
                                                std::remove_pointer_t<std::remove_reference_t<T>>>::value;
 
+/// determine if a type is a pointer to an object derived from trackable
+template <typename T>
+constexpr bool is_trackable_v = std::is_pointer<std::decay_t<T>>::value &&
+                                std::is_base_of<::sigslot::trackable,
+                                                std::remove_pointer_t<std::decay_t<T>>>::value;
+
 template <typename S>
 constexpr bool is_signal_v = detail::is_signal<S>::value;
 
@@ -208,6 +255,15 @@ struct func_ptr {
         return reinterpret_cast<const T*>(data);
     }
 
+    // a hash of the stored pointer, 0 if none is stored
+    std::size_t hash() const noexcept {
+        std::size_t h = sz;
+        for (std::size_t i = 0; i < sz; ++i) {
+            h = (h ^ static_cast<unsigned char>(data[i])) * 1099511628211ull;
+        }
+        return h;
+    }
+
 private:
     alignas(sizeof(mock::fun_types)) char data[sizeof(mock::fun_types)];
     size_t sz;
@@ -399,6 +455,132 @@ private:
     std::atomic<bool> state {true};
 };
 
+/**
+ * Memory resource the slots and slot lists of a signal are allocated from,
+ * when polymorphic memory resources are available. A null resource stands for
+ * the global allocator.
+ */
+#ifdef SIGSLOT_PMR_ENABLED
+using memory_resource = std::pmr::memory_resource;
+#else
+class memory_resource;
+#endif
+
+inline void * allocate_bytes(memory_resource *r, std::size_t n, std::size_t align) {
+#ifdef SIGSLOT_PMR_ENABLED
+    if (r) {
+        return r->allocate(n, align);
+    }
+#endif
+    (void)r;
+    (void)align;
+    return ::operator new(n);
+}
+
+inline void deallocate_bytes(memory_resource *r, void *p, std::size_t n, std::size_t align) noexcept {
+#ifdef SIGSLOT_PMR_ENABLED
+    if (r) {
+        r->deallocate(p, n, align);
+        return;
+    }
+#endif
+    (void)r;
+    (void)n;
+    (void)align;
+    ::operator delete(p);
+}
+
+/**
+ * An allocator drawing memory from a memory resource. Unlike
+ * std::pmr::polymorphic_allocator, copies of a container keep the resource
+ * of the original, which is what copy on write containers need.
+ */
+template <typename T>
+struct resource_allocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    resource_allocator() = default;
+
+    explicit resource_allocator(memory_resource *r) noexcept : resource(r) {}
+
+    template <typename U>
+    resource_allocator(const resource_allocator<U> &o) noexcept : resource(o.resource) {}
+
+    T * allocate(std::size_t n) {
+        return static_cast<T *>(allocate_bytes(resource, n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept {
+        deallocate_bytes(resource, p, n * sizeof(T), alignof(T));
+    }
+
+    memory_resource *resource = nullptr;
+};
+
+template <typename T, typename U>
+bool operator==(const resource_allocator<T> &a, const resource_allocator<U> &b) noexcept {
+    return a.resource == b.resource;
+}
+
+template <typename T, typename U>
+bool operator!=(const resource_allocator<T> &a, const resource_allocator<U> &b) noexcept {
+    return a.resource != b.resource;
+}
+
+/**
+ * The heap objects backing the containers of slot lists are allocated with the
+ * allocator of the value they hold, if it has one.
+ */
+template <typename T, typename = void>
+struct allocator_of {
+    using type = std::allocator<T>;
+    static type get(const T &) noexcept { return {}; }
+};
+
+template <typename T>
+struct allocator_of<T, trait::detail::void_t<typename T::allocator_type>> {
+    using type = typename T::allocator_type;
+    static type get(const T &v) noexcept { return v.get_allocator(); }
+};
+
+template <typename T>
+typename allocator_of<T>::type value_allocator(const T &v) noexcept {
+    return allocator_of<T>::get(v);
+}
+
+// create an object of type U with a rebound copy of allocator a
+template <typename U, typename Alloc, typename... A>
+U * allocate_object(const Alloc &a, A && ...args) {
+    using alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<U>;
+    using traits = std::allocator_traits<alloc_type>;
+
+    struct guard {
+        ~guard() {
+            if (p) {
+                traits::deallocate(alloc, p, 1);
+            }
+        }
+        alloc_type alloc;
+        U *p;
+    } g{alloc_type(a), nullptr};
+
+    g.p = traits::allocate(g.alloc, 1);
+    U *p = ::new (static_cast<void *>(g.p)) U(std::forward<A>(args)...);
+    g.p = nullptr;
+    return p;
+}
+
+// destroy an object created by allocate_object
+template <typename U, typename Alloc>
+void destroy_object(const Alloc &a, U *p) noexcept {
+    using alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<U>;
+    alloc_type alloc(a);
+    p->~U();
+    std::allocator_traits<alloc_type>::deallocate(alloc, p, 1);
+}
+
 /**
  * A simple copy on write container that will be used to improve slot lists
  * access efficiency in a multithreaded context.
@@ -414,6 +596,7 @@ class copy_on_write {
         {}
 
         std::atomic<std::size_t> count{1};
+        std::atomic<std::size_t> emissions{0};
         T value;
     };
 
@@ -421,13 +604,18 @@ public:
     using element_type = T;
 
     copy_on_write()
-        : m_data(new payload)
+        : m_data(allocate_object<payload>(typename allocator_of<T>::type{}))
+    {}
+
+    // an empty handle, only meant to be assigned to
+    explicit copy_on_write(std::nullptr_t) noexcept
+        : m_data(nullptr)
     {}
 
     template <typename U>
     explicit copy_on_write(U && x, std::enable_if_t<!std::is_same<std::decay_t<U>,
                            copy_on_write>::value>* = nullptr)
-        : m_data(new payload(std::forward<U>(x)))
+        : m_data(allocate_object<payload>(value_allocator(x), std::forward<U>(x)))
     {}
 
     copy_on_write(const copy_on_write &x) noexcept
@@ -444,7 +632,7 @@ public:
 
     ~copy_on_write() {
         if (m_data && (--m_data->count == 0)) {
-            delete m_data;
+            destroy_object(value_allocator(m_data->value), m_data);
         }
     }
 
@@ -477,11 +665,20 @@ public:
         swap(x.m_data, y.m_data);
     }
 
-private:
     bool unique() const noexcept {
         return m_data->count == 1;
     }
 
+    // count the emissions going over the value, which hold references to it
+    void enter() const noexcept {
+        m_data->emissions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // true for the last emission leaving the value
+    bool leave() const noexcept {
+        return m_data->emissions.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
 private:
     payload *m_data;
 };
@@ -510,1037 +707,5576 @@ T& cow_write(copy_on_write<T> &v) {
 }
 
 /**
- * std::make_shared instantiates a lot a templates, and makes both compilation time
- * and executable size far bigger than they need to be. We offer a make_shared
- * equivalent that will avoid most instantiations with the following tradeoffs:
- * - Not exception safe,
- * - Allocates a separate control block, and will thus make the code slower.
- */
-#ifdef SIGSLOT_REDUCE_COMPILE_TIME
-template <typename B, typename D, typename ...Arg>
-inline std::shared_ptr<B> make_shared(Arg && ... arg) {
-    return std::shared_ptr<B>(static_cast<B*>(new D(std::forward<Arg>(arg)...)));
+ * The container, if writing to it would copy it because readers share it, or
+ * nullptr when it would not or when that cannot be told.
+ */
+template <typename T>
+const T* cow_shared(const T &) noexcept {
+    return nullptr;
 }
-#else
-template <typename B, typename D, typename ...Arg>
-inline std::shared_ptr<B> make_shared(Arg && ... arg) {
-    return std::static_pointer_cast<B>(std::make_shared<D>(std::forward<Arg>(arg)...));
+
+template <typename T>
+const T* cow_shared(const copy_on_write<T> &v) noexcept {
+    return v.unique() ? nullptr : &v.read();
 }
-#endif
 
+/**
+ * An emission going over a reference to a container, counted if the container
+ * is copied on write, so that nested or concurrent emissions over the same
+ * value can tell which one leaves it last.
+ */
+template <typename T>
+class cow_emission {
+public:
+    explicit cow_emission(const T &) noexcept {}
+
+    // whether no other emission goes over the value, unknown when not counted
+    bool leave() noexcept { return false; }
+};
 
-// Adapt a signal into a cheap function object, for easy signal chaining
-template <typename SigT>
-struct signal_wrapper {
-    template <typename... U>
-    void operator()(U && ...u) {
-        (*m_sig)(std::forward<U>(u)...);
+template <typename T>
+class cow_emission<copy_on_write<T>> {
+public:
+    explicit cow_emission(const copy_on_write<T> &v) noexcept
+        : m_ref(&v)
+    {
+        m_ref->enter();
     }
 
-    SigT *m_sig{};
-};
+    ~cow_emission() {
+        if (m_ref) {
+            m_ref->leave();
+        }
+    }
 
+    cow_emission(const cow_emission &) = delete;
+    cow_emission & operator=(const cow_emission &) = delete;
 
-/* slot_state holds slot type independent state, to be used to interact with
- * slots indirectly through connection and scoped_connection objects.
+    bool leave() noexcept {
+        return std::exchange(m_ref, nullptr)->leave();
+    }
+
+private:
+    const copy_on_write<T> *m_ref;
+};
+
+/**
+ * Epoch based reclamation domain, used by the lock-free emission mode.
+ *
+ * Every thread owns a record in which it announces the global epoch it observed
+ * when it started reading shared data. Data superseded by a writer is retired
+ * along with the global epoch at the time. The global epoch only moves forward
+ * once all the pinned threads observed its current value, so retired data may
+ * be reclaimed as soon as the epoch moved two steps further.
+ *
+ * Records also hold the hazards of their thread, objects that the thread uses
+ * and that must not be destroyed until it announces it is done with them.
+ *
+ * Reclamation runs arbitrary destructors, which is why it never happens while
+ * retiring, typically under the lock of a writer. It is attempted by writers
+ * once they released their lock, and by readers leaving their outermost
+ * critical section while retired data is pending.
  */
-class slot_state {
+class epoch_domain {
 public:
-    constexpr slot_state(group_id gid) noexcept
-        : m_index(0)
-        , m_group(gid)
-        , m_connected(true)
-        , m_blocked(false)
-    {}
+    static constexpr std::size_t max_hazards = 8;
+
+    struct record {
+        std::atomic<std::uint64_t> epoch{0};  // 0 when the thread is not pinned
+        std::atomic<bool> used{true};
+        record *next = nullptr;
+        std::atomic<std::size_t> hazard_count{0};  // may exceed max_hazards
+        std::atomic<const void *> hazards[max_hazards]{};
+        char padding[64];                     // keep records on their own cache line
+    };
 
-    virtual ~slot_state() = default;
+    // the domain is leaked on purpose, thread records may outlive static objects
+    static epoch_domain & instance() {
+        static epoch_domain *d = new epoch_domain;
+        return *d;
+    }
 
-    virtual bool connected() const noexcept { return m_connected; }
+    // the record of the calling thread
+    static record & local() {
+        thread_local record_holder holder{instance().acquire_record()};
+        return *holder.rec;
+    }
 
-    bool disconnect() noexcept {
-        bool ret = m_connected.exchange(false);
-        if (ret) {
-            do_disconnect();
+    // nesting level of read-side critical sections of the calling thread
+    static std::size_t & depth() noexcept {
+        thread_local std::size_t d = 0;
+        return d;
+    }
+
+    // enter a read-side critical section, may be nested
+    void pin(record &r) noexcept {
+        if (depth()++ == 0) {
+            r.epoch.store(m_epoch.load());
         }
-        return ret;
     }
 
-    bool blocked() const noexcept { return m_blocked.load(); }
-    void block()   noexcept { m_blocked.store(true); }
-    void unblock() noexcept { m_blocked.store(false); }
+    // leave a read-side critical section
+    void unpin(record &r) noexcept {
+        if (--depth() == 0) {
+            r.epoch.store(0, std::memory_order_release);
+            collect(false);
+        }
+    }
 
-protected:
-    virtual void do_disconnect() {}
+    // defer the destruction of p until no reader can observe it anymore
+    template <typename T>
+    void retire(T *p) {
+        auto *r = new retired{m_epoch.load(), p, [](void *q) {
+            auto *t = static_cast<T*>(q);
+            destroy_object(value_allocator(*t), t);
+        }, nullptr};
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        r->next = m_retired;
+        m_retired = r;
+        m_pending.fetch_add(1, std::memory_order_relaxed);
+    }
 
-    auto index() const {
-        return m_index;
+    // reclaim what can be if some retired data is pending, readers giving up
+    // rather than waiting for another thread busy retiring or reclaiming
+    void collect(bool wait = true) noexcept {
+        if (m_pending.load(std::memory_order_relaxed) > 0) {
+            reclaim(wait);
+        }
     }
 
-    auto& index() {
-        return m_index;
+    // announce a hazard of the calling thread, sequentially consistent so that
+    // a thread checking the object afterwards is seen by wait_hazard()
+    static void push_hazard(record &r, const void *p) noexcept {
+        const auto n = r.hazard_count.load(std::memory_order_relaxed);
+        if (n < max_hazards) {
+            r.hazards[n].store(p, std::memory_order_relaxed);
+        }
+        r.hazard_count.store(n + 1);
     }
 
-    group_id group() const {
-        return m_group;
+    // remove the last hazard announced by the calling thread
+    static void pop_hazard(record &r) noexcept {
+        r.hazard_count.store(r.hazard_count.load(std::memory_order_relaxed) - 1,
+                             std::memory_order_release);
+    }
+
+    // wait for the other threads to drop p from their hazards, those with too
+    // many of them being waited for until they are back under the limit
+    void wait_hazard(const void *p) {
+        const auto *self = &local();
+        for (auto *r = m_head.load(std::memory_order_acquire); r; r = r->next) {
+            while (r != self && has_hazard(*r, p)) {
+                std::this_thread::yield();
+            }
+        }
     }
 
 private:
-    template <typename, typename...>
-    friend class ::sigslot::signal_base;
+    struct retired {
+        std::uint64_t epoch;
+        void *ptr;
+        void (*deleter)(void*);
+        retired *next;
+    };
 
-    std::size_t m_index;     // index into the array of slot pointers inside the signal
-    const group_id m_group;  // slot group this slot belongs to
-    std::atomic<bool> m_connected;
-    std::atomic<bool> m_blocked;
-};
+    // reclaim the retired data that is not reachable by readers anymore,
+    // possibly giving up if another thread holds the lock
+    void reclaim(bool wait) noexcept {
+        try_advance();
+        try_advance();
+
+        retired *garbage = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+            if (wait) {
+                lock.lock();
+            } else if (!lock.try_lock()) {
+                return;
+            }
 
-} // namespace detail
+            const auto e = m_epoch.load();
+            std::size_t count = 0;
+            for (auto **it = &m_retired; *it;) {
+                auto *r = *it;
+                if (r->epoch + 2 <= e) {
+                    *it = r->next;
+                    r->next = garbage;
+                    garbage = r;
+                    ++count;
+                } else {
+                    it = &r->next;
+                }
+            }
+            m_pending.fetch_sub(count, std::memory_order_relaxed);
+        }
 
-/**
- * connection_blocker is a RAII object that blocks a connection until destruction
- */
-class connection_blocker {
-public:
-    connection_blocker() = default;
-    ~connection_blocker() noexcept { release(); }
+        // deleters may run arbitrary code, which is why they run out of the lock
+        while (garbage) {
+            auto *r = garbage;
+            garbage = r->next;
+            r->deleter(r->ptr);
+            delete r;
+        }
+    }
 
-    connection_blocker(const connection_blocker &) = delete;
-    connection_blocker & operator=(const connection_blocker &) = delete;
+    struct record_holder {
+        record *rec;
+        ~record_holder() {
+            rec->epoch.store(0);
+            rec->used.store(false, std::memory_order_release);
+        }
+    };
 
-    connection_blocker(connection_blocker && o) noexcept
-        : m_state{std::move(o.m_state)}
-    {}
+    epoch_domain() = default;
 
-    connection_blocker & operator=(connection_blocker && o) noexcept {
-        release();
-        m_state.swap(o.m_state);
-        return *this;
+    // reuse the record of a finished thread, or register a new one
+    record * acquire_record() {
+        for (auto *r = m_head.load(std::memory_order_acquire); r; r = r->next) {
+            bool expected = false;
+            if (!r->used.load(std::memory_order_relaxed) &&
+                r->used.compare_exchange_strong(expected, true)) {
+                return r;
+            }
+        }
+
+        auto *r = new record;
+        r->next = m_head.load(std::memory_order_relaxed);
+        while (!m_head.compare_exchange_weak(r->next, r, std::memory_order_release,
+                                             std::memory_order_relaxed)) {}
+        return r;
     }
 
-private:
-    friend class connection;
-    explicit connection_blocker(std::weak_ptr<detail::slot_state> s) noexcept
-        : m_state{std::move(s)}
-    {
-        if (auto d = m_state.lock()) {
-            d->block();
+    static bool has_hazard(const record &r, const void *p) noexcept {
+        const auto n = r.hazard_count.load();
+        if (n > max_hazards) {
+            return true;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            if (r.hazards[i].load() == p) {
+                return true;
+            }
         }
+        return false;
     }
 
-    void release() noexcept {
-        if (auto d = m_state.lock()) {
-            d->unblock();
+    // move the epoch forward if every pinned thread observed the current one
+    void try_advance() noexcept {
+        auto e = m_epoch.load();
+        for (auto *r = m_head.load(std::memory_order_acquire); r; r = r->next) {
+            const auto re = r->epoch.load();
+            if (re != 0 && re != e) {
+                return;
+            }
         }
+        m_epoch.compare_exchange_strong(e, e + 1);
     }
 
 private:
-    std::weak_ptr<detail::slot_state> m_state;
+    std::atomic<std::uint64_t> m_epoch{1};
+    std::atomic<record*> m_head{nullptr};
+    std::atomic<std::size_t> m_pending{0};
+    std::mutex m_mutex;
+    retired *m_retired = nullptr;
 };
 
-
 /**
- * A connection object allows interaction with an ongoing slot connection
- *
- * It allows common actions such as connection blocking and disconnection.
- * Note that connection is not a RAII object, one does not need to hold one
- * such object to keep the signal-slot connection alive.
+ * A read-only view over the value of an epoch_cell, which keeps the calling
+ * thread pinned to the current epoch as long as it is alive.
  */
-class connection {
+template <typename T>
+class epoch_snapshot {
 public:
-    connection() = default;
-    virtual ~connection() = default;
+    explicit epoch_snapshot(const std::atomic<T*> &p) noexcept
+        : m_rec(&epoch_domain::local())
+    {
+        epoch_domain::instance().pin(*m_rec);
+        m_data = p.load();
+    }
 
-    connection(const connection &) noexcept = default;
-    connection & operator=(const connection &) noexcept = default;
-    connection(connection &&) noexcept = default;
-    connection & operator=(connection &&) noexcept = default;
+    epoch_snapshot(epoch_snapshot && o) noexcept
+        : m_rec(o.m_rec)
+        , m_data(o.m_data)
+    {
+        o.m_rec = nullptr;
+    }
 
-    bool valid() const noexcept {
-        return !m_state.expired();
+    epoch_snapshot(const epoch_snapshot &) = delete;
+    epoch_snapshot & operator=(const epoch_snapshot &) = delete;
+    epoch_snapshot & operator=(epoch_snapshot &&) = delete;
+
+    ~epoch_snapshot() {
+        if (m_rec) {
+            epoch_domain::instance().unpin(*m_rec);
+        }
     }
 
-    bool connected() const noexcept {
-        const auto d = m_state.lock();
-        return d && d->connected();
+    const T& read() const noexcept {
+        return *m_data;
     }
 
-    bool disconnect() noexcept {
-        auto d = m_state.lock();
-        return d && d->disconnect();
+private:
+    epoch_domain::record *m_rec;
+    const T *m_data;
+};
+
+/**
+ * A container of a value that can be read without locking, in the fashion of
+ * RCU. Writers, which must be serialized by the caller, modify a private copy
+ * of the value that gets atomically published, the previous one being retired
+ * until no reader can still observe it.
+ */
+template <typename T>
+class epoch_cell {
+public:
+    using element_type = T;
+
+    epoch_cell()
+        : epoch_cell(T{})
+    {}
+
+    explicit epoch_cell(T v)
+        : m_data(allocate_object<T>(value_allocator(v), std::move(v)))
+    {}
+
+    epoch_cell(const epoch_cell &) = delete;
+    epoch_cell & operator=(const epoch_cell &) = delete;
+
+    ~epoch_cell() {
+        if (m_pending) {
+            destroy_object(value_allocator(*m_pending), m_pending);
+        }
+
+        auto *p = m_data.load();
+        // a destruction from inside a slot must not pull the rug out from
+        // under the ongoing emission
+        if (epoch_domain::depth() > 0) {
+            epoch_domain::instance().retire(p);
+        } else {
+            destroy_object(value_allocator(*p), p);
+        }
     }
 
-    bool blocked() const noexcept {
-        const auto d = m_state.lock();
-        return d && d->blocked();
+    epoch_snapshot<T> snapshot() const noexcept {
+        return epoch_snapshot<T>{m_data};
     }
 
-    void block() noexcept {
-        if (auto d = m_state.lock()) {
-            d->block();
+    // obtain a private copy of the value, to be published after modification
+    element_type& write() {
+        if (!m_pending) {
+            const T &cur = *m_data.load(std::memory_order_relaxed);
+            m_pending = allocate_object<T>(value_allocator(cur), cur);
         }
+        return *m_pending;
     }
 
-    void unblock() noexcept {
-        if (auto d = m_state.lock()) {
-            d->unblock();
+    // make the modified value visible to readers
+    void publish() {
+        if (m_pending) {
+            epoch_domain::instance().retire(m_data.exchange(m_pending));
+            m_pending = nullptr;
         }
     }
 
-    connection_blocker blocker() const noexcept {
-        return connection_blocker{m_state};
+    friend inline void swap(epoch_cell &x, epoch_cell &y) noexcept {
+        y.m_data.store(x.m_data.exchange(y.m_data.load()));
     }
 
-protected:
-    template <typename, typename...> friend class signal_base;
-    explicit connection(std::weak_ptr<detail::slot_state> s) noexcept
-        : m_state{std::move(s)}
-    {}
-
-protected:
-    std::weak_ptr<detail::slot_state> m_state;
+private:
+    std::atomic<T*> m_data;
+    T *m_pending = nullptr;
 };
 
+template <typename T>
+const T& cow_read(epoch_snapshot<T> &v) {
+    return v.read();
+}
+
+template <typename T>
+T& cow_write(epoch_cell<T> &v) {
+    return v.write();
+}
+
 /**
- * scoped_connection is a RAII version of connection
- * It disconnects the slot from the signal upon destruction.
+ * Publication of the modifications made through cow_write(), only required
+ * for containers that are read without locking
  */
-class scoped_connection final : public connection {
-public:
-    scoped_connection() = default;
-    ~scoped_connection() override {
-        disconnect();
-    }
+template <typename T>
+void cow_publish(T &) {}
 
-    /*implicit*/ scoped_connection(const connection &c) noexcept : connection(c) {}
-    /*implicit*/ scoped_connection(connection &&c) noexcept : connection(std::move(c)) {}
+template <typename T>
+void cow_publish(epoch_cell<T> &v) {
+    v.publish();
+}
 
-    scoped_connection(const scoped_connection &) noexcept = delete;
-    scoped_connection & operator=(const scoped_connection &) noexcept = delete;
+template <typename T>
+const T* cow_shared(const epoch_cell<T> &) noexcept {
+    return nullptr;
+}
 
-    scoped_connection(scoped_connection && o) noexcept
-        : connection{std::move(o.m_state)}
-    {}
+/**
+ * Acquisition of a read reference to a container, under lock if need be
+ */
+template <typename T, typename L>
+const T& cow_snapshot(const T &v, L &) {
+    return v;
+}
 
-    scoped_connection & operator=(scoped_connection && o) noexcept {
-        disconnect();
-        m_state.swap(o.m_state);
-        return *this;
-    }
+template <typename T, typename L>
+copy_on_write<T> cow_snapshot(const copy_on_write<T> &v, L &m) {
+    std::unique_lock<L> lock(m);
+    return v;
+}
 
-private:
-    template <typename, typename...> friend class signal_base;
-    explicit scoped_connection(std::weak_ptr<detail::slot_state> s) noexcept
-        : connection{std::move(s)}
-    {}
-};
+template <typename T, typename L>
+epoch_snapshot<T> cow_snapshot(const epoch_cell<T> &v, L &) {
+    return v.snapshot();
+}
 
 /**
- * Observer is a base class for intrusive lifetime tracking of objects.
- *
- * This is an alternative to trackable pointers, such as std::shared_ptr,
- * and manual connection management by keeping connection objects in scope.
- * Deriving from this class allows automatic disconnection of all the slots
- * connected to any signal when an instance is destroyed.
+ * A small per-thread cache of copy_on_write handles, indexed by container.
+ * Entries in use by an ongoing emission are pinned and never replaced.
  */
-template <typename Lockable>
-struct observer_base : private detail::observer_type {
-    virtual ~observer_base() = default;
+template <typename T>
+struct snapshot_cache {
+    struct entry {
+        std::uint64_t gen = 0;
+        std::size_t pins = 0;
+        copy_on_write<T> data{nullptr};
+    };
 
-protected:
-    /**
-     * Disconnect all signals connected to this object.
-     *
-     * To avoid invocation of slots on a semi-destructed instance, which may happen
-     * in multi-threaded contexts, derived classes should call this method in their
-     * destructor. This will ensure proper disconnection prior to the destruction.
-     */
-    void disconnect_all() {
-        std::unique_lock<Lockable> _{m_mutex};
-        m_connections.clear();
+    snapshot_cache() noexcept { destroyed() = false; }
+    ~snapshot_cache() { destroyed() = true; }
+
+    // the cache entry dedicated to owner, or nullptr once the thread is exiting
+    static entry * get(const void *owner) noexcept {
+        if (destroyed()) {
+            return nullptr;
+        }
+        thread_local snapshot_cache cache;
+        const auto p = reinterpret_cast<std::uintptr_t>(owner);
+        return &cache.entries[((p >> 4) ^ (p >> 9)) % size];
     }
 
-private:
-    template <typename, typename ...>
-    friend class signal_base;
+    static constexpr std::size_t size = 8;
+    entry entries[size];
 
-    void add_connection(connection conn) {
-        std::unique_lock<Lockable> _{m_mutex};
-        m_connections.emplace_back(std::move(conn));
+private:
+    // trivially destructible, so that it can be checked after thread exit
+    static bool & destroyed() noexcept {
+        thread_local bool d = false;
+        return d;
     }
-
-    Lockable m_mutex;
-    std::vector<scoped_connection> m_connections;
 };
 
 /**
- * Specialization of observer_base to be used in single threaded contexts.
+ * A read-only reference to the value of a cached_cow, either borrowed from the
+ * per-thread cache or owned when the cache entry was not available.
  */
-using observer_st = observer_base<detail::null_mutex>;
+template <typename T>
+class cached_snapshot {
+    using entry = typename snapshot_cache<T>::entry;
 
-/**
- * Specialization of observer_base to be used in multi-threaded contexts.
- */
-using observer = observer_base<std::mutex>;
+public:
+    explicit cached_snapshot(entry &e) noexcept
+        : m_entry(&e)
+        , m_own(nullptr)
+    {
+        ++m_entry->pins;
+    }
 
+    explicit cached_snapshot(copy_on_write<T> && d) noexcept
+        : m_entry(nullptr)
+        , m_own(std::move(d))
+    {}
 
-namespace detail {
+    cached_snapshot(cached_snapshot && o) noexcept
+        : m_entry(o.m_entry)
+        , m_own(std::move(o.m_own))
+    {
+        o.m_entry = nullptr;
+    }
 
-// interface for cleanable objects, used to cleanup disconnected slots
-struct cleanable {
-    virtual ~cleanable() = default;
-    virtual void clean(slot_state *) = 0;
-};
+    cached_snapshot(const cached_snapshot &) = delete;
+    cached_snapshot & operator=(const cached_snapshot &) = delete;
+    cached_snapshot & operator=(cached_snapshot &&) = delete;
 
-template <typename...>
-class slot_base;
+    ~cached_snapshot() {
+        if (m_entry) {
+            --m_entry->pins;
+        }
+    }
 
-template <typename... T>
-using slot_ptr = std::shared_ptr<slot_base<T...>>;
+    const T& read() const noexcept {
+        return m_entry ? m_entry->data.read() : m_own.read();
+    }
 
+private:
+    entry *m_entry;
+    copy_on_write<T> m_own;
+};
 
-/* A base class for slot objects. This base type only depends on slot argument
- * types, it will be used as an element in an intrusive singly-linked list of
- * slots, hence the public next member.
+/**
+ * A copy on write container whose readers keep a per-thread copy of the handle
+ * and only refresh it, under lock, when a generation number bumped by every
+ * modification tells them it is stale. Generation numbers are unique among
+ * all the containers so that a cache entry can never be mistaken for another.
  */
-template <typename... Args>
-class slot_base : public slot_state {
+template <typename T>
+class cached_cow {
+    using cache = snapshot_cache<T>;
+
 public:
-    using base_types = trait::typelist<Args...>;
+    using element_type = T;
 
-    explicit slot_base(cleanable &c, group_id gid)
-        : slot_state(gid)
-        , cleaner(c)
+    cached_cow()
+        : m_gen(next_generation())
     {}
-    ~slot_base() override = default;
 
-    // method effectively responsible for calling the "slot" function with
-    // supplied arguments whenever emission happens.
-    virtual void call_slot(Args...) = 0;
+    explicit cached_cow(T v)
+        : m_data(std::move(v))
+        , m_gen(next_generation())
+    {}
 
-    template <typename... U>
-    void operator()(U && ...u) {
-        if (slot_state::connected() && !slot_state::blocked()) {
-            call_slot(std::forward<U>(u)...);
-        }
-    }
+    cached_cow(const cached_cow &) = delete;
+    cached_cow & operator=(const cached_cow &) = delete;
 
-    // check if we are storing callable c
-    template <typename C>
-    bool has_callable(const C &c) const {
-        auto p = get_callable();
-        return eq_function_ptr(c, p);
+    ~cached_cow() {
+        release_local(m_gen.load(std::memory_order_relaxed));
     }
 
-    template <typename C>
-    std::enable_if_t<function_traits<C>::must_check_object, bool>
-    has_full_callable(const C &c) const {
-        return has_callable(c) && check_class_type<std::decay_t<C>>();
-    }
+    template <typename L>
+    cached_snapshot<T> snapshot(L &m) const {
+        auto *e = cache::get(this);
+        if (e && e->gen == m_gen.load(std::memory_order_relaxed)) {
+            return cached_snapshot<T>{*e};
+        }
 
-    template <typename C>
-    std::enable_if_t<!function_traits<C>::must_check_object, bool>
-    has_full_callable(const C &c) const {
-        return has_callable(c);
-    }
+        copy_on_write<T> fresh{nullptr};
+        std::uint64_t gen = 0;
+        {
+            std::unique_lock<L> lock(m);
+            fresh = m_data;
+            gen = m_gen.load(std::memory_order_relaxed);
+        }
 
-    // check if we are storing object o
-    template <typename O>
-    bool has_object(const O &o) const {
-        return get_object() == get_object_ptr(o);
-    }
+        // an outer emission may still be iterating over this entry
+        if (!e || e->pins > 0) {
+            return cached_snapshot<T>{std::move(fresh)};
+        }
 
-protected:
-    void do_disconnect() final {
-        cleaner.clean(this);
+        e->data = std::move(fresh);
+        e->gen = gen;
+        return cached_snapshot<T>{*e};
     }
 
-    // retieve a pointer to the object embedded in the slot
-    virtual obj_ptr get_object() const noexcept {
-        return nullptr;
+    // to be called by writers under lock
+    element_type& write() {
+        return m_data.write();
     }
 
-    // retieve a pointer to the callable embedded in the slot
-    virtual func_ptr get_callable() const noexcept {
-        return get_function_ptr(nullptr);
+    // invalidate the cached handles
+    void publish() {
+        release_local(m_gen.exchange(next_generation(), std::memory_order_relaxed));
     }
 
-#ifdef SIGSLOT_RTTI_ENABLED
-    // retieve a pointer to the callable embedded in the slot
-    virtual const std::type_info& get_callable_type() const noexcept {
-        return typeid(nullptr);
+    friend inline void swap(cached_cow &x, cached_cow &y) noexcept {
+        using std::swap;
+        swap(x.m_data, y.m_data);
+        x.publish();
+        y.publish();
     }
 
 private:
-    template <typename U>
-    bool check_class_type() const {
-        return typeid(U) == get_callable_type();
+    static std::uint64_t next_generation() noexcept {
+        static std::atomic<std::uint64_t> gen{1};
+        return gen.fetch_add(1, std::memory_order_relaxed);
     }
 
-#else
-    template <typename U>
-    bool check_class_type() const {
-        return false;
+    // drop the handle cached by the calling thread, if any, so that a thread
+    // modifying the signals it emits does not delay the destruction of slots
+    void release_local(std::uint64_t gen) const noexcept {
+        auto *e = cache::get(this);
+        if (e && e->gen == gen && e->pins == 0) {
+            e->data = copy_on_write<T>{nullptr};
+            e->gen = 0;
+        }
     }
-#endif
 
 private:
-    cleanable &cleaner;
+    copy_on_write<T> m_data;
+    std::atomic<std::uint64_t> m_gen;
 };
 
-/*
- * A slot object holds state information, and a callable to to be called
- * whenever the function call operator of its slot_base base class is called.
- */
-template <typename Func, typename... Args>
-class slot final : public slot_base<Args...> {
-public:
-    template <typename F, typename Gid>
-    constexpr slot(cleanable &c, F && f, Gid gid)
-        : slot_base<Args...>(c, gid)
-        , func{std::forward<F>(f)} {}
+template <typename T>
+const T& cow_read(cached_snapshot<T> &v) {
+    return v.read();
+}
 
-protected:
-    void call_slot(Args ...args) override {
-        func(args...);
-    }
+template <typename T>
+T& cow_write(cached_cow<T> &v) {
+    return v.write();
+}
 
-    func_ptr get_callable() const noexcept override {
-        return get_function_ptr(func);
-    }
+template <typename T>
+void cow_publish(cached_cow<T> &v) {
+    v.publish();
+}
 
-#ifdef SIGSLOT_RTTI_ENABLED
-    const std::type_info& get_callable_type() const noexcept override {
-        return typeid(func);
+// the per-thread caches always share the list, they are left out
+template <typename T>
+const T* cow_shared(const cached_cow<T> &) noexcept {
+    return nullptr;
+}
+
+template <typename T, typename L>
+cached_snapshot<T> cow_snapshot(const cached_cow<T> &v, L &m) {
+    return v.snapshot(m);
+}
+
+/**
+ * Lockable adapter that selects the lock-free emission mode of signal_base.
+ * The adapted Lockable only serializes writers, readers never take it. The
+ * slot lists retired by a writer are reclaimed once it released the lock.
+ */
+template <typename Lockable>
+struct epoch_lock : Lockable {
+    void unlock() {
+        Lockable::unlock();
+        epoch_domain::instance().collect();
     }
-#endif
+};
 
-private:
-    std::decay_t<Func> func;
+/**
+ * Lockable adapter that selects the cached emission mode of signal_base.
+ * Emitting threads only take the adapted Lockable after a modification of
+ * the slot list.
+ */
+template <typename Lockable>
+struct cached_lock : Lockable {};
+
+/**
+ * Lockable adapter that selects the fixed capacity storage of signal_base.
+ * Up to N slots are stored in blocks allocated once, when the signal gets
+ * constructed, which never allocates afterwards, and emission copies the slot
+ * list on the stack under the adapted Lockable.
+ */
+template <typename Lockable, std::size_t N>
+struct inplace_lock : Lockable {
+    static_assert(N > 0, "an inplace signal needs room for at least one slot");
 };
 
-/*
- * Variation of slot that prepends a connection object to the callable
+template <typename T, typename L, std::size_t N>
+T cow_snapshot(const T &v, inplace_lock<L, N> &m) {
+    std::unique_lock<inplace_lock<L, N>> lock(m);
+    return v;
+}
+
+/**
+ * The slot list of a single-threaded signal, which emission goes over in place
+ * rather than through a copy, along with the number of references to it. While
+ * referenced, it must not be reordered: disconnected slots are then left in it
+ * as tombstones.
  */
-template <typename Func, typename... Args>
-class slot_extended final : public slot_base<Args...> {
+template <typename T>
+class emitted_list {
 public:
-    template <typename F>
-    constexpr slot_extended(cleanable &c, F && f, group_id gid)
-        : slot_base<Args...>(c, gid)
-        , func{std::forward<F>(f)} {}
+    emitted_list() = default;
 
-    connection conn;
+    explicit emitted_list(T v)
+        : m_value(std::move(v))
+    {}
 
-protected:
-    void call_slot(Args ...args) override {
-        func(conn, args...);
+    const T& read() const noexcept {
+        return m_value;
     }
 
-    func_ptr get_callable() const noexcept override {
-        return get_function_ptr(func);
+    T& write() noexcept {
+        return m_value;
     }
 
-#ifdef SIGSLOT_RTTI_ENABLED
-    const std::type_info& get_callable_type() const noexcept override {
-        return typeid(func);
+    std::size_t readers() const noexcept {
+        return m_readers;
     }
-#endif
 
 private:
-    std::decay_t<Func> func;
+    template <typename>
+    friend class emitted_ref;
+
+    T m_value;
+    mutable std::size_t m_readers = 0;
 };
 
-/*
- * A slot object holds state information, an object and a pointer over member
- * function to be called whenever the function call operator of its slot_base
- * base class is called.
+/**
+ * A read reference to an emitted_list, counted in the list while alive.
  */
-template <typename Pmf, typename Ptr, typename... Args>
-class slot_pmf final : public slot_base<Args...> {
+template <typename T>
+class emitted_ref {
 public:
-    template <typename F, typename P>
-    constexpr slot_pmf(cleanable &c, F && f, P && p, group_id gid)
-        : slot_base<Args...>(c, gid)
-        , pmf{std::forward<F>(f)}
-        , ptr{std::forward<P>(p)} {}
-
-protected:
-    void call_slot(Args ...args) override {
-        ((*ptr).*pmf)(args...);
+    explicit emitted_ref(const emitted_list<T> &l) noexcept
+        : m_list(&l)
+    {
+        ++m_list->m_readers;
     }
 
-    func_ptr get_callable() const noexcept override {
-        return get_function_ptr(pmf);
+    emitted_ref(emitted_ref && o) noexcept
+        : m_list(std::exchange(o.m_list, nullptr))
+    {}
+
+    emitted_ref(const emitted_ref &) = delete;
+    emitted_ref & operator=(const emitted_ref &) = delete;
+    emitted_ref & operator=(emitted_ref &&) = delete;
+
+    ~emitted_ref() {
+        if (m_list) {
+            --m_list->m_readers;
+        }
     }
 
-    obj_ptr get_object() const noexcept override {
-        return get_object_ptr(ptr);
+    const T& read() const noexcept {
+        return m_list->read();
     }
 
-#ifdef SIGSLOT_RTTI_ENABLED
-    const std::type_info& get_callable_type() const noexcept override {
-        return typeid(pmf);
+    // whether no other reference to the list is alive
+    bool last() const noexcept {
+        return m_list->readers() == 1;
     }
-#endif
 
 private:
-    std::decay_t<Pmf> pmf;
-    std::decay_t<Ptr> ptr;
+    const emitted_list<T> *m_list;
 };
 
-/*
- * Variation of slot that prepends a connection object to the callable
- */
-template <typename Pmf, typename Ptr, typename... Args>
-class slot_pmf_extended final : public slot_base<Args...> {
-public:
-    template <typename F, typename P>
-    constexpr slot_pmf_extended(cleanable &c, F && f, P && p, group_id gid)
-        : slot_base<Args...>(c, gid)
-        , pmf{std::forward<F>(f)}
-        , ptr{std::forward<P>(p)} {}
-
-    connection conn;
+template <typename T>
+const T& cow_read(emitted_ref<T> &v) {
+    return v.read();
+}
 
-protected:
-    void call_slot(Args ...args) override {
-        ((*ptr).*pmf)(conn, args...);
-    }
+template <typename T>
+T& cow_write(emitted_list<T> &v) {
+    return v.write();
+}
 
-    func_ptr get_callable() const noexcept override {
-        return get_function_ptr(pmf);
-    }
-    obj_ptr get_object() const noexcept override {
-        return get_object_ptr(ptr);
-    }
+template <typename T, typename L>
+emitted_ref<T> cow_snapshot(const emitted_list<T> &v, L &) {
+    return emitted_ref<T>{v};
+}
 
-#ifdef SIGSLOT_RTTI_ENABLED
-    const std::type_info& get_callable_type() const noexcept override {
-        return typeid(pmf);
+template <typename T>
+const T* cow_shared(const emitted_list<T> &v) noexcept {
+    return v.readers() > 0 ? &v.read() : nullptr;
+}
+
+// the signal owns the list, which is thus still shared with it
+template <typename T>
+const T* cow_shared(const emitted_ref<T> &v) noexcept {
+    return &v.read();
+}
+
+template <typename T>
+class cow_emission<emitted_ref<T>> {
+public:
+    explicit cow_emission(const emitted_ref<T> &v) noexcept
+        : m_ref(v)
+    {}
+
+    bool leave() noexcept {
+        return m_ref.last();
     }
-#endif
 
 private:
-    std::decay_t<Pmf> pmf;
-    std::decay_t<Ptr> ptr;
+    const emitted_ref<T> &m_ref;
 };
 
-/*
- * An implementation of a slot that tracks the life of a supplied object
- * through a weak pointer in order to automatically disconnect the slot
- * on said object destruction.
+/**
+ * Whether a shared container can be copied for writing, rather than being
+ * left untouched until no reader refers to it anymore.
  */
-template <typename Func, typename WeakPtr, typename... Args>
-class slot_tracked final : public slot_base<Args...> {
-public:
-    template <typename F, typename P>
-    constexpr slot_tracked(cleanable &c, F && f, P && p, group_id gid)
-        : slot_base<Args...>(c, gid)
-        , func{std::forward<F>(f)}
-        , ptr{std::forward<P>(p)}
-    {}
+template <typename T>
+struct cow_copies : std::true_type {};
 
-    bool connected() const noexcept override {
-        return !ptr.expired() && slot_state::connected();
-    }
+template <typename T>
+struct cow_copies<emitted_list<T>> : std::false_type {};
 
-protected:
-    void call_slot(Args ...args) override {
-        auto sp = ptr.lock();
-        if (!sp) {
-            slot_state::disconnect();
-            return;
-        }
-        if (slot_state::connected()) {
-            func(args...);
-        }
-    }
+/**
+ * Storage of the slot list of a signal and type of the references obtained
+ * from it for emission, according to its Lockable type.
+ */
+template <typename T, typename L>
+struct cow_traits {
+    using type = copy_on_write<T>;
+    using copy_type = copy_on_write<T>;
+};
 
-    func_ptr get_callable() const noexcept override {
-        return get_function_ptr(func);
-    }
+template <typename T>
+struct cow_traits<T, null_mutex> {
+    using type = emitted_list<T>;
+    using copy_type = emitted_ref<T>;
+};
 
-    obj_ptr get_object() const noexcept override {
-        return get_object_ptr(ptr);
-    }
+template <typename T, typename L>
+struct cow_traits<T, epoch_lock<L>> {
+    using type = epoch_cell<T>;
+    using copy_type = epoch_snapshot<T>;
+};
 
-#ifdef SIGSLOT_RTTI_ENABLED
-    const std::type_info& get_callable_type() const noexcept override {
-        return typeid(func);
-    }
-#endif
+template <typename T, typename L>
+struct cow_traits<T, cached_lock<L>> {
+    using type = cached_cow<T>;
+    using copy_type = cached_snapshot<T>;
+};
 
-private:
-    std::decay_t<Func> func;
-    std::decay_t<WeakPtr> ptr;
+template <typename T, typename L, std::size_t N>
+struct cow_traits<T, inplace_lock<L, N>> {
+    using type = T;
+    using copy_type = T;
 };
 
-// Same as above with extended signature
-template <typename Func, typename WeakPtr, typename... Args>
-class slot_tracked_extended final : public slot_base<Args...> {
+/**
+ * Maximum number of slots a signal may store according to its Lockable type,
+ * 0 standing for no limit.
+ */
+template <typename L>
+struct slot_capacity : std::integral_constant<std::size_t, 0> {};
+
+template <typename L, std::size_t N>
+struct slot_capacity<inplace_lock<L, N>> : std::integral_constant<std::size_t, N> {};
+
+/**
+ * Interface of the pools slots are allocated from.
+ */
+class slot_pool_base {
 public:
-    template <typename F, typename P>
-    constexpr slot_tracked_extended(cleanable &c, F && f, P && p, group_id gid)
-        : slot_base<Args...>(c, gid)
-        , func{std::forward<F>(f)}
-        , ptr{std::forward<P>(p)}
-    {}
+    static constexpr std::size_t block_size = 128;
+    static constexpr std::size_t block_align = alignof(std::max_align_t);
+
+    virtual void * allocate(std::size_t size) = 0;
+    virtual void deallocate(void *p, std::size_t size) noexcept = 0;
 
-    connection conn;
+protected:
+    ~slot_pool_base() = default;
+
+    union block {
+        block *next;
+        alignas(block_align) unsigned char data[block_size];
+    };
+};
 
-    bool connected() const noexcept override {
-        return !ptr.expired() && slot_state::connected();
+/**
+ * A pool of fixed size memory blocks, used by a signal to store its slots.
+ *
+ * Slots are small objects that may be connected and disconnected at a high
+ * rate, each connection costing an allocation. The pool carves blocks out of
+ * chunks of geometrically growing size and recycles them through a free list,
+ * so that slot churn stays out of the global allocator and the slots of a
+ * signal lie close together in memory. Chunks, as well as the slots too large
+ * to fit in a block, are obtained from the memory resource of the signal.
+ *
+ * The pool is reference counted: its owner holds a reference, and so does each
+ * block handed out, so that slots outliving their signal remain valid.
+ */
+template <typename Lockable>
+class slot_pool final : public slot_pool_base {
+public:
+    static slot_pool * create(memory_resource *r) {
+        void *p = allocate_bytes(r, sizeof(slot_pool), alignof(slot_pool));
+        return ::new (p) slot_pool(r);
     }
 
-protected:
-    void call_slot(Args ...args) override {
-        auto sp = ptr.lock();
-        if (!sp) {
-            slot_state::disconnect();
-            return;
-        }
-        if (slot_state::connected()) {
-            func(conn, args...);
-        }
+    void retain() noexcept {
+        m_refs.fetch_add(1, std::memory_order_relaxed);
     }
 
-    func_ptr get_callable() const noexcept override {
-        return get_function_ptr(func);
+    void release() noexcept {
+        if (m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            auto *r = m_resource;
+            this->~slot_pool();
+            deallocate_bytes(r, this, sizeof(slot_pool), alignof(slot_pool));
+        }
     }
 
-    obj_ptr get_object() const noexcept override {
-        return get_object_ptr(ptr);
+    void * allocate(std::size_t size) override {
+        if (size > block_size) {
+            void *p = allocate_bytes(m_resource, size, block_align);
+            retain();
+            return p;
+        }
+
+        std::lock_guard<Lockable> lock(m_mutex);
+        if (!m_free) {
+            grow();
+        }
+        auto *b = m_free;
+        m_free = b->next;
+        retain();
+        return b;
     }
 
-#ifdef SIGSLOT_RTTI_ENABLED
-    const std::type_info& get_callable_type() const noexcept override {
-        return typeid(func);
+    void deallocate(void *p, std::size_t size) noexcept override {
+        if (size > block_size) {
+            deallocate_bytes(m_resource, p, size, block_align);
+        } else {
+            std::lock_guard<Lockable> lock(m_mutex);
+            auto *b = static_cast<block *>(p);
+            b->next = m_free;
+            m_free = b;
+        }
+        release();
     }
-#endif
 
 private:
-    std::decay_t<Func> func;
-    std::decay_t<WeakPtr> ptr;
-};
+    struct chunk {
+        block *blocks;
+        std::size_t count;
+    };
 
-/*
- * An implementation of a slot as a pointer over member function, that tracks
- * the life of a supplied object through a weak pointer in order to automatically
- * disconnect the slot on said object destruction.
- */
-template <typename Pmf, typename WeakPtr, typename... Args>
-class slot_pmf_tracked final : public slot_base<Args...> {
-public:
-    template <typename F, typename P>
-    constexpr slot_pmf_tracked(cleanable &c, F && f, P && p, group_id gid)
-        : slot_base<Args...>(c, gid)
-        , pmf{std::forward<F>(f)}
-        , ptr{std::forward<P>(p)}
+    static constexpr std::size_t max_chunk_blocks = 256;
+
+    explicit slot_pool(memory_resource *r)
+        : m_resource(r)
+        , m_chunks(resource_allocator<chunk>(r))
     {}
 
-    bool connected() const noexcept override {
-        return !ptr.expired() && slot_state::connected();
+    ~slot_pool() {
+        for (const auto &c : m_chunks) {
+            deallocate_bytes(m_resource, c.blocks, c.count * sizeof(block), alignof(block));
+        }
     }
 
-protected:
-    void call_slot(Args ...args) override {
-        auto sp = ptr.lock();
-        if (!sp) {
-            slot_state::disconnect();
-            return;
-        }
-        if (slot_state::connected()) {
-            ((*sp).*pmf)(args...);
+    // to be called under lock: add a chunk of blocks to the free list
+    void grow() {
+        const auto n = m_chunk_blocks;
+        m_chunks.reserve(m_chunks.size() + 1);
+        auto *blocks = static_cast<block *>(allocate_bytes(m_resource, n * sizeof(block), alignof(block)));
+        m_chunks.push_back({blocks, n});
+        m_chunk_blocks = 2 * n < max_chunk_blocks ? 2 * n : max_chunk_blocks;
+
+        for (std::size_t i = n; i > 0; --i) {
+            blocks[i-1].next = m_free;
+            m_free = &blocks[i-1];
         }
     }
 
-    func_ptr get_callable() const noexcept override {
-        return get_function_ptr(pmf);
+    Lockable m_mutex;
+    memory_resource *m_resource;
+    block *m_free = nullptr;
+    std::size_t m_chunk_blocks = 4;
+    std::vector<chunk, resource_allocator<chunk>> m_chunks;
+    std::atomic<std::size_t> m_refs{1};
+};
+
+/**
+ * Reference held by a signal to its slot pool, which is created on first use.
+ */
+template <typename Lockable>
+class slot_pool_holder {
+    using pool_type = slot_pool<Lockable>;
+
+public:
+    slot_pool_holder() = default;
+
+    // the pool is created on first use, from the resource given then
+    explicit slot_pool_holder(memory_resource *) noexcept {}
+
+    slot_pool_holder(slot_pool_holder &&o) noexcept
+        : m_pool{o.m_pool.exchange(nullptr)}
+    {}
+
+    ~slot_pool_holder() {
+        if (auto *p = m_pool.load(std::memory_order_acquire)) {
+            p->release();
+        }
     }
 
-    obj_ptr get_object() const noexcept override {
-        return get_object_ptr(ptr);
+    void swap(slot_pool_holder &o) noexcept {
+        m_pool.store(o.m_pool.exchange(m_pool.load()));
     }
 
-#ifdef SIGSLOT_RTTI_ENABLED
-    const std::type_info& get_callable_type() const noexcept override {
-        return typeid(pmf);
+    // the pool to allocate a new slot from
+    slot_pool_base * acquire(memory_resource *r) {
+        auto *p = m_pool.load(std::memory_order_acquire);
+        if (!p) {
+            auto *n = pool_type::create(r);
+            if (m_pool.compare_exchange_strong(p, n, std::memory_order_acq_rel,
+                                               std::memory_order_acquire)) {
+                p = n;
+            } else {
+                n->release();
+            }
+        }
+        return p;
     }
-#endif
 
 private:
-    std::decay_t<Pmf> pmf;
-    std::decay_t<WeakPtr> ptr;
+    std::atomic<pool_type *> m_pool{nullptr};
 };
 
-// same as above with extended signature
-template <typename Pmf, typename WeakPtr, typename... Args>
-class slot_pmf_tracked_extended final : public slot_base<Args...> {
+/**
+ * Slot storage of an inplace signal: a fixed number of blocks, allocated in a
+ * single piece from the memory resource of the signal, the heap by default,
+ * when the signal gets constructed.
+ *
+ * A block is reserved before a slot gets allocated, so that a full signal is
+ * reported to the signal instead of failing the allocation. The block of a slot
+ * is only given back once no connection object refers to the slot state
+ * anymore, holding on to the connection objects of disconnected slots thus
+ * keeps their blocks in use.
+ *
+ * The pool is reference counted like slot_pool, so that connection objects
+ * may outlive the signal, which is why it cannot be stored inside it.
+ */
+template <typename Lockable, std::size_t N>
+class inplace_pool final : public slot_pool_base {
 public:
-    template <typename F, typename P>
-    constexpr slot_pmf_tracked_extended(cleanable &c, F && f, P && p, group_id gid)
-        : slot_base<Args...>(c, gid)
-        , pmf{std::forward<F>(f)}
-        , ptr{std::forward<P>(p)}
-    {}
-
-    connection conn;
+    static inplace_pool * create(memory_resource *r) {
+        void *p = allocate_bytes(r, sizeof(inplace_pool), alignof(inplace_pool));
+        return ::new (p) inplace_pool(r);
+    }
 
-    bool connected() const noexcept override {
-        return !ptr.expired() && slot_state::connected();
+    void retain() noexcept {
+        m_refs.fetch_add(1, std::memory_order_relaxed);
     }
 
-protected:
-    void call_slot(Args ...args) override {
-        auto sp = ptr.lock();
-        if (!sp) {
-            slot_state::disconnect();
-            return;
-        }
-        if (slot_state::connected()) {
-            ((*sp).*pmf)(conn, args...);
+    void release() noexcept {
+        if (m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            auto *r = m_resource;
+            this->~inplace_pool();
+            deallocate_bytes(r, this, sizeof(inplace_pool), alignof(inplace_pool));
         }
     }
 
-    func_ptr get_callable() const noexcept override {
-        return get_function_ptr(pmf);
+    // reserve a block for a slot, false if the signal is full
+    bool reserve() noexcept {
+        auto n = m_available.load(std::memory_order_relaxed);
+        do {
+            if (n == 0) {
+                return false;
+            }
+        } while (!m_available.compare_exchange_weak(n, n - 1, std::memory_order_acquire,
+                                                    std::memory_order_relaxed));
+        return true;
     }
 
-    obj_ptr get_object() const noexcept override {
-        return get_object_ptr(ptr);
+    // a block was reserved beforehand, so there is always one left
+    void * allocate(std::size_t) noexcept override {
+        std::lock_guard<Lockable> lock(m_mutex);
+        auto *b = m_free;
+        m_free = b->next;
+        retain();
+        return b;
     }
 
-#ifdef SIGSLOT_RTTI_ENABLED
-    const std::type_info& get_callable_type() const noexcept override {
-        return typeid(pmf);
+    void deallocate(void *p, std::size_t) noexcept override {
+        {
+            std::lock_guard<Lockable> lock(m_mutex);
+            auto *b = static_cast<block *>(p);
+            b->next = m_free;
+            m_free = b;
+        }
+        m_available.fetch_add(1, std::memory_order_release);
+        release();
     }
-#endif
 
 private:
-    std::decay_t<Pmf> pmf;
-    std::decay_t<WeakPtr> ptr;
-};
+    explicit inplace_pool(memory_resource *r) noexcept
+        : m_resource(r)
+    {
+        for (std::size_t i = N; i > 0; --i) {
+            m_blocks[i-1].next = m_free;
+            m_free = &m_blocks[i-1];
+        }
+    }
 
-} // namespace detail
+    ~inplace_pool() = default;
 
+    Lockable m_mutex;
+    memory_resource *m_resource;
+    block *m_free = nullptr;
+    std::atomic<std::size_t> m_available{N};
+    std::atomic<std::size_t> m_refs{1};
+    block m_blocks[N];
+};
 
 /**
- * signal_base is an implementation of the observer pattern, through the use
- * of an emitting object and slots that are connected to the signal and called
- * with supplied arguments when a signal is emitted.
- *
- * signal_base is the general implementation, whose locking policy must be
- * set in order to decide thread safety guarantees. signal and signal_st
- * are partial specializations for multi-threaded and single-threaded use.
- *
- * It does not allow slots to return a value.
- *
- * Slot execution order can be constrained by assigning group ids to the slots.
- * The execution order of slots in a same group is unspecified and should not be
- * relied upon, however groups are executed in ascending group ids order. When
- * the group id of a slot is not set, it is assigned to the group 0. Group ids
- * can have any value in the range of signed 32 bit integers.
- *
- * @tparam Lockable a lock type to decide the lock policy
- * @tparam T... the argument types of the emitting and slots functions.
+ * Reference held by an inplace signal to its slot pool, which is created by the
+ * constructor of the signal, so that connecting never allocates.
  */
-template <typename Lockable, typename... T>
-class signal_base final : public detail::cleanable {
-    template <typename L>
-    using is_thread_safe = std::integral_constant<bool, !std::is_same<L, detail::null_mutex>::value>;
-
-    template <typename U, typename L>
-    using cow_type = std::conditional_t<is_thread_safe<L>::value,
-                                        detail::copy_on_write<U>, U>;
+template <typename L, std::size_t N>
+class slot_pool_holder<inplace_lock<L, N>> {
+    using pool_type = inplace_pool<L, N>;
 
-    template <typename U, typename L>
-    using cow_copy_type = std::conditional_t<is_thread_safe<L>::value,
-                                             detail::copy_on_write<U>, const U&>;
+public:
+    slot_pool_holder()
+        : m_pool{pool_type::create(nullptr)}
+    {}
 
-    using lock_type = std::unique_lock<Lockable>;
-    using slot_base = detail::slot_base<T...>;
-    using slot_ptr = detail::slot_ptr<T...>;
-    using slots_type = std::vector<slot_ptr>;
-    struct group_type { slots_type slts; group_id gid; };
-    using list_type = std::vector<group_type>;  // kept ordered by ascending gid
+    explicit slot_pool_holder(memory_resource *r)
+        : m_pool{pool_type::create(r)}
+    {}
 
-public:
-    using arg_list = trait::typelist<T...>;
-    using ext_arg_list = trait::typelist<connection&, T...>;
+    slot_pool_holder(slot_pool_holder &&) = delete;
 
-    signal_base() noexcept : m_block(false) {}
-    ~signal_base() override {
-        disconnect_all();
+    ~slot_pool_holder() {
+        m_pool->release();
     }
 
-    signal_base(const signal_base&) = delete;
-    signal_base & operator=(const signal_base&) = delete;
-
-    signal_base(signal_base && o) /* not noexcept */
-        : m_block{o.m_block.load()}
-    {
-        lock_type lock(o.m_mutex);
-        using std::swap;
-        swap(m_slots, o.m_slots);
+    // the pool to allocate a new slot from, nullptr if the signal is full
+    slot_pool_base * acquire(memory_resource *) noexcept {
+        return m_pool->reserve() ? m_pool : nullptr;
     }
 
-    signal_base & operator=(signal_base && o) /* not noexcept */ {
-        lock_type lock1(m_mutex, std::defer_lock);
-        lock_type lock2(o.m_mutex, std::defer_lock);
-        std::lock(lock1, lock2);
+private:
+    pool_type *m_pool;
+};
 
-        using std::swap;
-        swap(m_slots, o.m_slots);
-        m_block.store(o.m_block.exchange(m_block.load()));
-        return *this;
-    }
 
-    /**
+// Call a slot with the arguments held by an item of an emission batch, which
+// is either the argument itself for single argument signals, or a tuple-like
+// object of arguments
+template <typename Slot, typename Item, std::size_t... I>
+void call_unpacked(Slot &s, Item &item, std::index_sequence<I...>) {
+    s(std::get<I>(item)...);
+}
+
+template <std::size_t N, typename Slot, typename Item>
+std::enable_if_t<N == 1> call_with_item(Slot &s, Item &item) {
+    s(item);
+}
+
+template <std::size_t N, typename Slot, typename Item>
+std::enable_if_t<N != 1> call_with_item(Slot &s, Item &item) {
+    call_unpacked(s, item, std::make_index_sequence<N>{});
+}
+
+// Adapt a signal into a cheap function object, for easy signal chaining
+template <typename SigT>
+struct signal_wrapper {
+    template <typename... U>
+    void operator()(U && ...u) {
+        (*m_sig)(std::forward<U>(u)...);
+    }
+
+    SigT *m_sig{};
+};
+
+
+template <typename, std::size_t>
+class slot_list;
+
+class slot_state;
+class slot_handle;
+
+// interface for cleanable objects, used to cleanup disconnected slots
+struct cleanable {
+    virtual ~cleanable() = default;
+    virtual void clean(slot_state *) = 0;
+
+    // remove all the slots detached by the caller at once
+    virtual void clean_detached(const slot_handle *first, const slot_handle *last) = 0;
+};
+
+/* slot_state holds slot type independent state, to be used to interact with
+ * slots indirectly through connection and scoped_connection objects.
+ *
+ * Slots are intrusively reference counted. Strong references are held by the
+ * slot lists of signals and their snapshots, and keep the slot callable alive.
+ * Connection handles hold weak references, which only keep the slot state
+ * alive, so that querying or changing the state of a connection boils down to
+ * an atomic operation on the slot state.
+ */
+class slot_state {
+public:
+    constexpr slot_state(group_id gid, bool tracked = false) noexcept
+        : m_index(0)
+        , m_group(gid)
+        , m_flags(connected_flag | (tracked ? tracked_flag : 0u))
+        , m_refs(1)
+        , m_handles(1)
+    {}
+
+    virtual ~slot_state() = default;
+
+    slot_state(const slot_state &) = delete;
+    slot_state & operator=(const slot_state &) = delete;
+
+    bool connected() const noexcept {
+        const auto f = m_flags.load(std::memory_order_acquire);
+        return (f & connected_flag) && (!(f & tracked_flag) || tracked_alive());
+    }
+
+    bool disconnect() noexcept {
+        const bool ret = detach();
+        if (ret) {
+            do_disconnect();
+        }
+        return ret;
+    }
+
+    // clear the connected flag, leaving the removal of the slot from its
+    // signal to the caller, and tell whether the slot was connected
+    bool detach() noexcept {
+        const auto f = m_flags.fetch_and(~connected_flag, std::memory_order_acq_rel);
+        return f & connected_flag;
+    }
+
+    // the signal the slot is connected to
+    virtual cleanable * owner() const noexcept { return nullptr; }
+
+    bool blocked() const noexcept {
+        return m_flags.load(std::memory_order_acquire) & blocked_flag;
+    }
+
+    void block() noexcept {
+        m_flags.fetch_or(blocked_flag, std::memory_order_acq_rel);
+    }
+
+    void unblock() noexcept {
+        m_flags.fetch_and(~blocked_flag, std::memory_order_acq_rel);
+    }
+
+    // emission path check, a single relaxed load telling whether the slot is
+    // connected and not blocked, leaving the tracked object to the slot
+    bool callable() const noexcept {
+        const auto f = m_flags.load(std::memory_order_relaxed);
+        return (f & (connected_flag | blocked_flag)) == connected_flag;
+    }
+
+    // strong references
+    void retain() noexcept {
+        m_refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release() noexcept {
+        if (m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            destroy();
+            release_handle();
+        }
+    }
+
+    bool expired() const noexcept {
+        return m_refs.load(std::memory_order_acquire) == 0;
+    }
+
+    // weak references, all the strong references account for one of them
+    void retain_handle() noexcept {
+        m_handles.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release_handle() noexcept {
+        if (m_handles.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    // slots are allocated along with a header recording the pool they come from
+    static constexpr std::size_t allocation_size(std::size_t size) noexcept {
+        return sizeof(header) + size;
+    }
+
+    static void * operator new(std::size_t size, slot_pool_base *pool) {
+        const auto total = allocation_size(size);
+        void *mem = pool ? pool->allocate(total) : ::operator new(total);
+        return ::new (mem) header{pool, total} + 1;
+    }
+
+    static void operator delete(void *p, slot_pool_base *) noexcept {
+        deallocate(p);
+    }
+
+    static void operator delete(void *p) noexcept {
+        deallocate(p);
+    }
+
+protected:
+    virtual void do_disconnect() {}
+
+    // whether the object tracked by the slot, if any, is still alive
+    virtual bool tracked_alive() const noexcept { return true; }
+
+    // the connected flag alone, regardless of the tracked object
+    bool connected_flag_set() const noexcept {
+        return m_flags.load(std::memory_order_acquire) & connected_flag;
+    }
+
+    // destroy what must not outlive the last strong reference, the callable
+    virtual void destroy() noexcept {}
+
+    auto index() const {
+        return m_index;
+    }
+
+    auto& index() {
+        return m_index;
+    }
+
+    group_id group() const {
+        return m_group;
+    }
+
+private:
+    template <typename, typename...>
+    friend class ::sigslot::signal_base;
+
+    template <typename, std::size_t>
+    friend class slot_list;
+
+    struct alignas(std::max_align_t) header {
+        slot_pool_base *pool;
+        std::size_t size;
+    };
+
+    static void deallocate(void *p) noexcept {
+        auto *h = static_cast<header *>(p) - 1;
+        if (h->pool) {
+            h->pool->deallocate(h, h->size);
+        } else {
+            ::operator delete(h);
+        }
+    }
+
+    // bits of the state word
+    static constexpr std::uint32_t connected_flag = 1;
+    static constexpr std::uint32_t blocked_flag = 2;
+    static constexpr std::uint32_t tracked_flag = 4;  // tracked_alive() matters
+
+    std::size_t m_index;     // position of the slot in its slot list
+    const group_id m_group;  // slot group this slot belongs to
+    std::atomic<std::uint32_t> m_flags;
+    std::atomic<std::uint32_t> m_refs;
+    std::atomic<std::uint32_t> m_handles;
+};
+
+/*
+ * A weak reference over a slot state, as held by connection objects.
+ */
+class slot_handle {
+public:
+    slot_handle() = default;
+
+    explicit slot_handle(slot_state *s) noexcept
+        : m_state{s}
+    {
+        if (m_state) {
+            m_state->retain_handle();
+        }
+    }
+
+    ~slot_handle() noexcept {
+        if (m_state) {
+            m_state->release_handle();
+        }
+    }
+
+    slot_handle(const slot_handle &o) noexcept
+        : slot_handle{o.m_state}
+    {}
+
+    slot_handle(slot_handle &&o) noexcept
+        : m_state{o.m_state}
+    {
+        o.m_state = nullptr;
+    }
+
+    slot_handle & operator=(slot_handle o) noexcept {
+        swap(o);
+        return *this;
+    }
+
+    void swap(slot_handle &o) noexcept {
+        std::swap(m_state, o.m_state);
+    }
+
+    slot_state * get() const noexcept {
+        return m_state;
+    }
+
+    slot_state * operator->() const noexcept {
+        return m_state;
+    }
+
+    explicit operator bool() const noexcept {
+        return m_state != nullptr;
+    }
+
+private:
+    slot_state *m_state = nullptr;
+};
+
+/**
+ * Allocator of the slots aligned beyond the blocks of slot pools, which come
+ * from the global allocator. The slot follows its header as usual, with some
+ * padding before the header to align the slot, the address of the allocation
+ * being stored right before the header.
+ */
+template <std::size_t Align>
+class aligned_slot_pool final : public slot_pool_base {
+public:
+    static aligned_slot_pool * instance() noexcept {
+        static aligned_slot_pool pool;
+        return &pool;
+    }
+
+    void * allocate(std::size_t size) override {
+        constexpr std::size_t offset = slot_state::allocation_size(0);
+        auto *raw = static_cast<unsigned char *>(::operator new(size + Align + sizeof(void *)));
+        auto addr = reinterpret_cast<std::uintptr_t>(raw + sizeof(void *) + offset);
+        addr = (addr + Align - 1) & ~static_cast<std::uintptr_t>(Align - 1);
+        auto *p = reinterpret_cast<unsigned char *>(addr) - offset;
+        std::memcpy(p - sizeof(void *), &raw, sizeof(void *));
+        return p;
+    }
+
+    void deallocate(void *p, std::size_t) noexcept override {
+        void *raw = nullptr;
+        std::memcpy(&raw, static_cast<unsigned char *>(p) - sizeof(void *), sizeof(void *));
+        ::operator delete(raw);
+    }
+};
+
+} // namespace detail
+
+/**
+ * connection_blocker is a RAII object that blocks a connection until destruction
+ */
+class connection_blocker {
+public:
+    connection_blocker() = default;
+    ~connection_blocker() noexcept { release(); }
+
+    connection_blocker(const connection_blocker &) = delete;
+    connection_blocker & operator=(const connection_blocker &) = delete;
+
+    connection_blocker(connection_blocker && o) noexcept
+        : m_state{std::move(o.m_state)}
+    {}
+
+    connection_blocker & operator=(connection_blocker && o) noexcept {
+        release();
+        m_state.swap(o.m_state);
+        return *this;
+    }
+
+private:
+    friend class connection;
+    explicit connection_blocker(detail::slot_handle s) noexcept
+        : m_state{std::move(s)}
+    {
+        if (m_state) {
+            m_state->block();
+        }
+    }
+
+    void release() noexcept {
+        if (m_state) {
+            m_state->unblock();
+        }
+    }
+
+private:
+    detail::slot_handle m_state;
+};
+
+
+/**
+ * A connection object allows interaction with an ongoing slot connection
+ *
+ * It allows common actions such as connection blocking and disconnection.
+ * Note that connection is not a RAII object, one does not need to hold one
+ * such object to keep the signal-slot connection alive.
+ */
+class connection {
+public:
+    connection() = default;
+    virtual ~connection() = default;
+
+    connection(const connection &) noexcept = default;
+    connection & operator=(const connection &) noexcept = default;
+    connection(connection &&) noexcept = default;
+    connection & operator=(connection &&) noexcept = default;
+
+    bool valid() const noexcept {
+        return m_state && !m_state->expired();
+    }
+
+    bool connected() const noexcept {
+        return m_state && m_state->connected();
+    }
+
+    bool disconnect() noexcept {
+        return m_state && m_state->disconnect();
+    }
+
+    bool blocked() const noexcept {
+        return m_state && m_state->blocked();
+    }
+
+    void block() noexcept {
+        if (m_state) {
+            m_state->block();
+        }
+    }
+
+    void unblock() noexcept {
+        if (m_state) {
+            m_state->unblock();
+        }
+    }
+
+    connection_blocker blocker() const noexcept {
+        return connection_blocker{m_state};
+    }
+
+protected:
+    template <typename, typename...> friend class signal_base;
+    friend class scoped_connection_group;
+    explicit connection(detail::slot_handle s) noexcept
+        : m_state{std::move(s)}
+    {}
+
+protected:
+    detail::slot_handle m_state;
+};
+
+/**
+ * scoped_connection is a RAII version of connection
+ * It disconnects the slot from the signal upon destruction.
+ */
+class scoped_connection final : public connection {
+public:
+    scoped_connection() = default;
+    ~scoped_connection() override {
+        disconnect();
+    }
+
+    /*implicit*/ scoped_connection(const connection &c) noexcept : connection(c) {}
+    /*implicit*/ scoped_connection(connection &&c) noexcept : connection(std::move(c)) {}
+
+    scoped_connection(const scoped_connection &) noexcept = delete;
+    scoped_connection & operator=(const scoped_connection &) noexcept = delete;
+
+    scoped_connection(scoped_connection && o) noexcept
+        : connection{std::move(o.m_state)}
+    {}
+
+    scoped_connection & operator=(scoped_connection && o) noexcept {
+        disconnect();
+        m_state.swap(o.m_state);
+        return *this;
+    }
+
+private:
+    template <typename, typename...> friend class signal_base;
+    explicit scoped_connection(detail::slot_handle s) noexcept
+        : connection{std::move(s)}
+    {}
+};
+
+/**
+ * scoped_connection_group is a RAII collection of connections, possibly made
+ * to different signals, which disconnects them all upon destruction.
+ *
+ * Destroying many scoped_connection objects locks the signal and rebuilds its
+ * slot list once per connection. A group rather marks all its slots as
+ * disconnected first, and then removes them from each signal under a single
+ * lock, with at most one slot list rebuild per signal.
+ */
+class scoped_connection_group {
+public:
+    scoped_connection_group() = default;
+    ~scoped_connection_group() {
+        disconnect();
+    }
+
+    scoped_connection_group(const scoped_connection_group &) = delete;
+    scoped_connection_group & operator=(const scoped_connection_group &) = delete;
+
+    scoped_connection_group(scoped_connection_group && o) noexcept
+        : m_states{std::move(o.m_states)}
+    {}
+
+    scoped_connection_group & operator=(scoped_connection_group && o) noexcept {
+        disconnect();
+        m_states.swap(o.m_states);
+        return *this;
+    }
+
+    /**
+     * Add a connection to the group
+     */
+    void add(connection c) {
+        if (c.m_state) {
+            m_states.push_back(std::move(c.m_state));
+        }
+    }
+
+    /**
+     * Take over a scoped connection, which does not disconnect its slot anymore
+     */
+    void add(scoped_connection &&c) {
+        if (c.m_state) {
+            m_states.emplace_back();
+            m_states.back().swap(c.m_state);
+        }
+    }
+
+    scoped_connection_group & operator+=(connection c) {
+        add(std::move(c));
+        return *this;
+    }
+
+    scoped_connection_group & operator+=(scoped_connection &&c) {
+        add(std::move(c));
+        return *this;
+    }
+
+    void reserve(std::size_t n) {
+        m_states.reserve(n);
+    }
+
+    std::size_t size() const noexcept {
+        return m_states.size();
+    }
+
+    bool empty() const noexcept {
+        return m_states.empty();
+    }
+
+    /**
+     * Disconnect all the connections of the group and empty it
+     *
+     * @return the number of slots that were still connected
+     */
+    std::size_t disconnect() noexcept {
+        // detach the slots, keeping those that were connected
+        auto last = std::remove_if(m_states.begin(), m_states.end(), [] (auto &s) {
+            return !s->detach() || !s->owner();
+        });
+
+        // clean each signal once, with the slots detached from it
+        std::sort(m_states.begin(), last, [] (const auto &a, const auto &b) {
+            return std::less<detail::cleanable *>{}(a->owner(), b->owner());
+        });
+
+        for (auto it = m_states.begin(); it != last;) {
+            auto *owner = (*it)->owner();
+            auto end = std::find_if(it, last, [owner] (const auto &s) {
+                return s->owner() != owner;
+            });
+            owner->clean_detached(&*it, &*it + (end - it));
+            it = end;
+        }
+
+        const auto count = static_cast<std::size_t>(last - m_states.begin());
+        m_states.clear();
+        return count;
+    }
+
+private:
+    std::vector<detail::slot_handle> m_states;
+};
+
+/**
+ * Observer is a base class for intrusive lifetime tracking of objects.
+ *
+ * This is an alternative to trackable pointers, such as std::shared_ptr,
+ * and manual connection management by keeping connection objects in scope.
+ * Deriving from this class allows automatic disconnection of all the slots
+ * connected to any signal when an instance is destroyed.
+ */
+template <typename Lockable>
+struct observer_base : private detail::observer_type {
+    virtual ~observer_base() = default;
+
+protected:
+    /**
+     * Disconnect all signals connected to this object.
+     *
+     * To avoid invocation of slots on a semi-destructed instance, which may happen
+     * in multi-threaded contexts, derived classes should call this method in their
+     * destructor. This will ensure proper disconnection prior to the destruction.
+     */
+    void disconnect_all() {
+        std::unique_lock<Lockable> _{m_mutex};
+        m_connections.disconnect();
+    }
+
+private:
+    template <typename, typename ...>
+    friend class signal_base;
+
+    void add_connection(connection conn) {
+        std::unique_lock<Lockable> _{m_mutex};
+        m_connections.add(std::move(conn));
+    }
+
+    Lockable m_mutex;
+    scoped_connection_group m_connections;
+};
+
+/**
+ * Specialization of observer_base to be used in single threaded contexts.
+ */
+using observer_st = observer_base<detail::null_mutex>;
+
+/**
+ * Specialization of observer_base to be used in multi-threaded contexts.
+ */
+using observer = observer_base<std::mutex>;
+
+
+namespace detail {
+
+// the liveness of a trackable object, shared with the slots tracking it
+struct trackable_state {
+    void retain() noexcept {
+        refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release() noexcept {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    std::atomic<bool> alive{true};
+    std::atomic<std::uint32_t> refs{1};
+};
+
+/*
+ * A call of a slot tracking a trackable object, which announces the object as
+ * a hazard in the epoch record of the calling thread, so that expiring the
+ * object waits for it without any write to state shared between threads. The
+ * calling thread is never waited for, so that a slot may expire its own object.
+ */
+class trackable_call {
+public:
+    explicit trackable_call(trackable_state &st) noexcept
+        : m_state{st}
+        , m_rec{&epoch_domain::local()}
+    {
+        // sequentially consistent, paired with the alive flag in expiration
+        epoch_domain::push_hazard(*m_rec, &m_state);
+    }
+
+    ~trackable_call() {
+        epoch_domain::pop_hazard(*m_rec);
+    }
+
+    trackable_call(const trackable_call &) = delete;
+    trackable_call & operator=(const trackable_call &) = delete;
+
+    bool alive() const noexcept {
+        return m_state.alive.load();
+    }
+
+    // wait for the calls of the slots tracking an expired object to return,
+    // except for those the calling thread is in
+    static void wait(const trackable_state &st) {
+        epoch_domain::instance().wait_hazard(&st);
+    }
+
+private:
+    trackable_state &m_state;
+    epoch_domain::record *m_rec;
+};
+
+} // namespace detail
+
+/**
+ * Trackable is a base class for intrusive lifetime tracking of objects, whose
+ * slots do not touch any reference count on emission.
+ *
+ * Slots connected along with a pointer to a trackable object announce the object
+ * in a record of their thread and check an alive flag, instead of locking a weak
+ * pointer. Destroying the object clears the flag, disconnects its slots and waits
+ * for the calls of those slots still running on other threads to return.
+ *
+ * To avoid invocation of slots on a semi-destructed instance, derived classes
+ * should call expire() first thing in their destructor. A slot destroying its
+ * own object must not expect the other threads to have left it.
+ */
+class trackable {
+public:
+    trackable()
+        : m_state{new detail::trackable_state}
+    {}
+
+    // connections are not copied along with the object
+    trackable(const trackable &)
+        : trackable()
+    {}
+
+    trackable & operator=(const trackable &) noexcept {
+        return *this;
+    }
+
+    virtual ~trackable() {
+        expire();
+        m_state->release();
+    }
+
+protected:
+    /**
+     * Disconnect all the slots tracking this object, and wait for their
+     * running calls to return.
+     */
+    void expire() {
+        if (!m_state->alive.exchange(false)) {
+            return;
+        }
+
+        scoped_connection_group conns;
+        {
+            std::lock_guard<std::mutex> _{m_mutex};
+            conns = std::move(m_connections);
+        }
+        conns.disconnect();
+
+        detail::trackable_call::wait(*m_state);
+    }
+
+private:
+    template <typename, typename ...>
+    friend class signal_base;
+
+    void add_connection(connection conn) const {
+        std::lock_guard<std::mutex> _{m_mutex};
+        m_connections.add(std::move(conn));
+    }
+
+    detail::trackable_state *m_state;
+    mutable std::mutex m_mutex;
+    mutable scoped_connection_group m_connections;
+};
+
+
+namespace detail {
+
+// A call posted to an event queue, run or merely destroyed by fn
+struct queued_call {
+    using call_fn = void (*)(queued_call *, bool run);
+
+    queued_call() noexcept = default;
+    explicit queued_call(call_fn f) noexcept : fn(f) {}
+
+    std::atomic<queued_call *> next{nullptr};
+    call_fn fn = nullptr;
+};
+
+template <typename, typename...>
+class slot_queued;
+
+template <typename, typename, typename...>
+class slot_queued_tracked;
+
+/*
+ * An emission deferred to the trampoline of the emitting thread.
+ */
+struct deferred_call {
+    using call_fn = void (*)(deferred_call *, bool run);
+
+    deferred_call(call_fn f, const void *o) noexcept : fn(f), owner(o) {}
+
+    deferred_call *next = nullptr;
+    call_fn fn;
+    const void *owner;
+};
+
+/*
+ * The per-thread trampoline of signals with a maximum emission depth. It keeps
+ * track of the depth of nested emissions of such signals, and of the emissions
+ * deferred for being too deep, which the outermost emission runs in order once
+ * its slots are done, rather than recursively.
+ */
+struct trampoline {
+    // one more nested emission, for the lifetime of the object
+    struct level {
+        explicit level(trampoline &tr) noexcept : t(tr) { ++t.depth; }
+        ~level() { --t.depth; }
+
+        level(const level &) = delete;
+        level & operator=(const level &) = delete;
+
+        trampoline &t;
+    };
+
+    static trampoline & local() noexcept {
+        thread_local trampoline t;
+        return t;
+    }
+
+    void push(deferred_call *c) noexcept {
+        if (tail) {
+            tail->next = c;
+        } else {
+            head = c;
+        }
+        tail = c;
+    }
+
+    deferred_call * pop() noexcept {
+        auto *c = head;
+        if (c) {
+            head = c->next;
+            if (!head) {
+                tail = nullptr;
+            }
+        }
+        return c;
+    }
+
+    // run the deferred emissions, including those they defer in turn
+    void drain() {
+        draining = true;
+        while (auto *c = pop()) {
+            c->fn(c, true);
+        }
+        draining = false;
+    }
+
+    // drop the deferred emissions, of a given signal or of all of them
+    void drop(const void *owner = nullptr) noexcept {
+        deferred_call *keep = nullptr;
+        while (auto *c = pop()) {
+            if (owner && c->owner != owner) {
+                c->next = keep;
+                keep = c;
+            } else {
+                c->fn(c, false);
+            }
+        }
+        // keep was built in reverse order
+        while (keep) {
+            auto *c = keep;
+            keep = c->next;
+            c->next = head;
+            head = c;
+            if (!tail) {
+                tail = c;
+            }
+        }
+    }
+
+    std::size_t depth = 0;
+    bool draining = false;
+    deferred_call *head = nullptr;
+    deferred_call *tail = nullptr;
+};
+
+/*
+ * Whether the emissions of a signal may be deferred, which copies the
+ * arguments: they must be copyable, and not references slots may write to,
+ * since the writes would go to the copies.
+ */
+template <typename T>
+struct deferrable_arg : std::integral_constant<bool,
+    std::is_copy_constructible<std::decay_t<T>>::value &&
+    !(std::is_lvalue_reference<T>::value && !std::is_const<std::remove_reference_t<T>>::value)> {};
+
+template <typename... T>
+struct deferrable : std::true_type {};
+
+template <typename T, typename... U>
+struct deferrable<T, U...>
+    : std::integral_constant<bool, deferrable_arg<T>::value && deferrable<U...>::value> {};
+
+/*
+ * A deferred emission of a signal, along with a copy of the arguments.
+ */
+template <typename Signal, typename... A>
+class deferred_emission final : public deferred_call {
+public:
+    template <typename... U>
+    explicit deferred_emission(const Signal *s, U && ...a)
+        : deferred_call(&run, s)
+        , sig{s}
+        , args{std::forward<U>(a)...}
+    {}
+
+private:
+    static void run(deferred_call *c, bool invoke) {
+        std::unique_ptr<deferred_emission> self{static_cast<deferred_emission *>(c)};
+        if (invoke) {
+            self->emit(std::index_sequence_for<A...>{});
+        }
+    }
+
+    template <std::size_t... I>
+    void emit(std::index_sequence<I...>) {
+        (*sig)(std::get<I>(args)...);
+    }
+
+    const Signal *sig;
+    std::tuple<A...> args;
+};
+
+} // namespace detail
+
+/**
+ * A queue of slot calls, run by the thread owning the queue, typically from
+ * its event loop.
+ *
+ * Slots connected through signal_base::connect_queued() do not run on the
+ * emitting thread. Emission copies the arguments into a call that gets posted
+ * to the queue, and process() later runs the pending calls. Posting is
+ * lock-free and may happen from any thread, while process() must only be
+ * called by one thread at a time.
+ *
+ * The queue must outlive the connections made with it, pending calls are
+ * dropped on destruction.
+ */
+class event_queue {
+public:
+    event_queue() noexcept
+        : m_head{&m_stub}
+        , m_tail{&m_stub}
+    {}
+
+    /**
+     * @param notify a function called after each post, to wake the owner up
+     */
+    explicit event_queue(std::function<void()> notify)
+        : event_queue()
+    {
+        m_notify = std::move(notify);
+    }
+
+    ~event_queue() {
+        while (auto *c = pop()) {
+            c->fn(c, false);
+        }
+    }
+
+    event_queue(const event_queue &) = delete;
+    event_queue & operator=(const event_queue &) = delete;
+
+    /**
+     * Run the pending calls, in the order they were posted, including those
+     * posted meanwhile.
+     *
+     * @param max the maximum number of calls to run
+     * @return the number of calls run
+     */
+    std::size_t process(std::size_t max = std::size_t(-1)) {
+        std::size_t count = 0;
+        while (count < max) {
+            auto *c = pop();
+            if (!c) {
+                break;
+            }
+            ++count;
+            c->fn(c, true);
+        }
+        return count;
+    }
+
+private:
+    template <typename, typename...>
+    friend class detail::slot_queued;
+
+    template <typename, typename, typename...>
+    friend class detail::slot_queued_tracked;
+
+    // multiple producers: link the call after the current head
+    void post(detail::queued_call *c) {
+        push(c);
+        if (m_notify) {
+            m_notify();
+        }
+    }
+
+    void push(detail::queued_call *c) noexcept {
+        c->next.store(nullptr, std::memory_order_relaxed);
+        auto *prev = m_head.exchange(c, std::memory_order_acq_rel);
+        prev->next.store(c, std::memory_order_release);
+    }
+
+    // single consumer: unlink the call at the tail, the stub node ensures that
+    // the list is never empty
+    detail::queued_call * pop() noexcept {
+        auto *tail = m_tail;
+        auto *next = tail->next.load(std::memory_order_acquire);
+
+        if (tail == &m_stub) {
+            if (!next) {
+                return nullptr;
+            }
+            m_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next) {
+            m_tail = next;
+            return tail;
+        }
+
+        // a producer is between the exchange and the link of its call
+        if (tail != m_head.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        push(&m_stub);
+        next = tail->next.load(std::memory_order_acquire);
+        if (next) {
+            m_tail = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+private:
+    detail::queued_call m_stub;
+    std::atomic<detail::queued_call *> m_head;
+    detail::queued_call *m_tail;
+    std::function<void()> m_notify;
+};
+
+
+namespace detail {
+
+template <typename...>
+class slot_base;
+
+/*
+ * A strong reference over an intrusively reference counted slot.
+ */
+template <typename T>
+class intrusive_ptr {
+public:
+    intrusive_ptr() = default;
+
+    // adopts a reference
+    explicit intrusive_ptr(T *p) noexcept
+        : m_ptr{p}
+    {}
+
+    ~intrusive_ptr() noexcept {
+        if (m_ptr) {
+            m_ptr->release();
+        }
+    }
+
+    intrusive_ptr(const intrusive_ptr &o) noexcept
+        : m_ptr{o.m_ptr}
+    {
+        if (m_ptr) {
+            m_ptr->retain();
+        }
+    }
+
+    intrusive_ptr(intrusive_ptr &&o) noexcept
+        : m_ptr{o.m_ptr}
+    {
+        o.m_ptr = nullptr;
+    }
+
+    intrusive_ptr & operator=(intrusive_ptr o) noexcept {
+        swap(o);
+        return *this;
+    }
+
+    void swap(intrusive_ptr &o) noexcept {
+        std::swap(m_ptr, o.m_ptr);
+    }
+
+    T * get() const noexcept {
+        return m_ptr;
+    }
+
+    T * operator->() const noexcept {
+        return m_ptr;
+    }
+
+    T & operator*() const noexcept {
+        return *m_ptr;
+    }
+
+    explicit operator bool() const noexcept {
+        return m_ptr != nullptr;
+    }
+
+private:
+    T *m_ptr = nullptr;
+};
+
+template <typename... T>
+using slot_ptr = intrusive_ptr<slot_base<T...>>;
+
+/*
+ * Storage for a slot member that must be destroyed along with the last strong
+ * reference to the slot, rather than with the slot state. This is the case of
+ * callables, which may hold resources, and of connections to the slot itself.
+ */
+template <typename T>
+union slot_member {
+    template <typename... A>
+    explicit slot_member(A && ...a) : value{std::forward<A>(a)...} {}
+    ~slot_member() {}
+
+    slot_member(const slot_member &) = delete;
+    slot_member & operator=(const slot_member &) = delete;
+
+    void destroy() noexcept {
+        value.~T();
+    }
+
+    T value;
+};
+
+
+/*
+ * Arguments go through the type-erased call of a slot by value when they are
+ * small and trivially copyable, and by const reference otherwise, so that
+ * heavy arguments are not copied once per slot. References are passed as is.
+ */
+template <typename T>
+constexpr bool pass_by_value_v = std::is_trivially_copyable<T>::value &&
+                                 sizeof(T) <= 2 * sizeof(void *);
+
+template <typename T, typename = void>
+struct arg_pass {
+    using type = const T &;
+};
+
+template <typename T>
+struct arg_pass<T, std::enable_if_t<pass_by_value_v<T>>> {
+    using type = T;
+};
+
+template <typename T>
+struct arg_pass<T &> {
+    using type = T &;
+};
+
+// rvalue references were always seen as lvalues by slots, they still are
+template <typename T>
+struct arg_pass<T &&> {
+    using type = const T &;
+};
+
+template <typename T>
+using arg_pass_t = typename arg_pass<T>::type;
+
+/*
+ * The last slot called by signal_base::emit_move() gets the arguments passed
+ * by const reference as rvalues instead.
+ */
+template <typename T>
+using arg_move_t = std::conditional_t<std::is_reference<T>::value || pass_by_value_v<T>, T, T &&>;
+
+// an argument of a moving call, copied if it must be moved but is an lvalue
+template <typename T, typename U>
+std::enable_if_t<std::is_rvalue_reference<arg_move_t<T>>::value &&
+                 std::is_lvalue_reference<U>::value, std::decay_t<T>>
+move_arg(U &&u) {
+    return std::decay_t<T>(u);
+}
+
+template <typename T, typename U>
+std::enable_if_t<!(std::is_rvalue_reference<arg_move_t<T>>::value &&
+                   std::is_lvalue_reference<U>::value), U &&>
+move_arg(U &&u) noexcept {
+    return std::forward<U>(u);
+}
+
+template <typename... T>
+struct fused_list;
+
+/* A base class for slot objects. This base type only depends on slot argument
+ * types.
+ *
+ * Rather than a virtual method, derived slots supply a plain function pointer
+ * that is effectively responsible for calling the "slot" function with
+ * supplied arguments whenever emission happens. It is a member of slot_base,
+ * read at a fixed offset from the slot, past the slot state and the cleaner,
+ * while the callable lives in the derived slot that follows. This spares
+ * emission a vtable load. The virtual methods are only used for disconnection
+ * purpose and stay out of the emission path.
+ */
+template <typename... Args>
+class slot_base : public slot_state {
+public:
+    using base_types = trait::typelist<Args...>;
+    using call_fn = void (*)(slot_base *, arg_pass_t<Args>...);
+
+    explicit slot_base(cleanable &c, group_id gid, call_fn call, bool tracked = false)
+        : slot_state(gid, tracked)
+        , cleaner(c)
+        , m_call(call)
+    {}
+    ~slot_base() override = default;
+
+    template <typename... U>
+    void operator()(U && ...u) {
+        if (slot_state::callable()) {
+            m_call(this, std::forward<U>(u)...);
+        }
+    }
+
+    // same, but the arguments may be moved into the callable
+    template <typename... U>
+    void call_moving(U && ...u) {
+        if (slot_state::callable()) {
+            call_move(std::forward<U>(u)...);
+        }
+    }
+
+    // check if we are storing callable c
+    template <typename C>
+    bool has_callable(const C &c) const {
+        auto p = get_callable();
+        return eq_function_ptr(c, p);
+    }
+
+    template <typename C>
+    std::enable_if_t<function_traits<C>::must_check_object, bool>
+    has_full_callable(const C &c) const {
+        return has_callable(c) && check_class_type<std::decay_t<C>>();
+    }
+
+    template <typename C>
+    std::enable_if_t<!function_traits<C>::must_check_object, bool>
+    has_full_callable(const C &c) const {
+        return has_callable(c);
+    }
+
+    // check if we are storing object o
+    template <typename O>
+    bool has_object(const O &o) const {
+        return get_object() == get_object_ptr(o);
+    }
+
+    // keys of the slot in a slot_index
+    obj_ptr object_key() const noexcept {
+        return get_object();
+    }
+
+    std::size_t callable_key() const noexcept {
+        return get_callable().hash();
+    }
+
+    // append the slots of the signal this slot is chained to, if it is a
+    // fused link, and tell whether it is one
+    virtual bool fuse(fused_list<Args...> &) const {
+        return false;
+    }
+
+    cleanable * owner() const noexcept final {
+        return &cleaner;
+    }
+
+protected:
+    void do_disconnect() final {
+        cleaner.clean(this);
+    }
+
+    // the moving call is seldom used, hence virtual rather than stored
+    virtual void call_move(arg_move_t<Args> ...args) {
+        m_call(this, args...);
+    }
+
+    // retieve a pointer to the object embedded in the slot
+    virtual obj_ptr get_object() const noexcept {
+        return nullptr;
+    }
+
+    // retieve a pointer to the callable embedded in the slot
+    virtual func_ptr get_callable() const noexcept {
+        return get_function_ptr(nullptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    // retieve a pointer to the callable embedded in the slot
+    virtual const std::type_info& get_callable_type() const noexcept {
+        return typeid(nullptr);
+    }
+
+private:
+    template <typename U>
+    bool check_class_type() const {
+        return typeid(U) == get_callable_type();
+    }
+
+#else
+    template <typename U>
+    bool check_class_type() const {
+        return false;
+    }
+#endif
+
+private:
+    cleanable &cleaner;
+    call_fn m_call;
+};
+
+/*
+ * An index of the slots of a signal by object and by callable, which turns
+ * disconnection by object or callable into hash lookups. It holds plain
+ * pointers and must be kept in sync with the slot list, under lock. The keys
+ * of a slot are recorded when it is inserted, since the object of a tracked
+ * slot cannot be retrieved anymore once it expired.
+ */
+template <typename Slot>
+class slot_index {
+    using keys_type = std::pair<obj_ptr, std::size_t>;
+    using bucket_type = std::unordered_set<Slot *>;
+
+public:
+    void insert(Slot *s) {
+        const keys_type keys{s->object_key(), s->callable_key()};
+        m_keys.emplace(s, keys);
+        if (keys.first) {
+            m_objects[keys.first].insert(s);
+        }
+        if (keys.second) {
+            m_callables[keys.second].insert(s);
+        }
+    }
+
+    void erase(const slot_state *s) noexcept {
+        auto it = m_keys.find(s);
+        if (it == m_keys.end()) {
+            return;
+        }
+        auto *slot = static_cast<Slot *>(const_cast<slot_state *>(s));
+        erase_from(m_objects, it->second.first, slot);
+        erase_from(m_callables, it->second.second, slot);
+        m_keys.erase(it);
+    }
+
+    void clear() noexcept {
+        m_keys.clear();
+        m_objects.clear();
+        m_callables.clear();
+    }
+
+    // call fn on each slot indexed under an object
+    template <typename Fn>
+    void for_object(obj_ptr o, Fn && fn) const {
+        for_each_in(m_objects, o, fn);
+    }
+
+    // call fn on each slot indexed under the hash of a callable
+    template <typename Fn>
+    void for_callable(std::size_t h, Fn && fn) const {
+        for_each_in(m_callables, h, fn);
+    }
+
+private:
+    template <typename Map, typename K>
+    static void erase_from(Map &m, const K &k, Slot *s) noexcept {
+        auto it = m.find(k);
+        if (it != m.end()) {
+            it->second.erase(s);
+            if (it->second.empty()) {
+                m.erase(it);
+            }
+        }
+    }
+
+    template <typename Map, typename K, typename Fn>
+    static void for_each_in(const Map &m, const K &k, Fn &fn) {
+        auto it = m.find(k);
+        if (it != m.end()) {
+            for (auto *s : it->second) {
+                fn(s);
+            }
+        }
+    }
+
+    std::unordered_map<const slot_state *, keys_type> m_keys;
+    std::unordered_map<obj_ptr, bucket_type> m_objects;
+    std::unordered_map<std::size_t, bucket_type> m_callables;
+};
+
+/*
+ * The flattened dispatch list of a signal with fused chained signals. Slots
+ * are listed in emission order, each fused link being followed by the slots of
+ * the signal it is chained to and knowing where they end, so that they can be
+ * skipped when the link is blocked. It remains valid as long as the versions
+ * of the signals it was built from did not change. Parents come before their
+ * children in the dependencies, a child being only checked once its parent is
+ * known to be unchanged, hence still linked to it and alive.
+ */
+template <typename... T>
+struct fused_list {
+    struct entry {
+        slot_ptr<T...> slot;
+        std::size_t end;  // one past the last fused slot for links, 0 otherwise
+    };
+
+    struct dependency {
+        const std::atomic<std::uint64_t> *version;
+        std::uint64_t value;
+    };
+
+    bool valid() const noexcept {
+        for (const auto &d : deps) {
+            if (d.version->load(std::memory_order_acquire) != d.value) {
+                return false;
+            }
+        }
+        return !deps.empty();
+    }
+
+    void clear() noexcept {
+        entries.clear();
+        deps.clear();
+    }
+
+    std::vector<entry> entries;
+    std::vector<dependency> deps;
+};
+
+// versions are unique among all the signals so that a flattened list built
+// for a signal can never be mistaken for one of another signal
+inline std::uint64_t next_fused_version() noexcept {
+    static std::atomic<std::uint64_t> version{1};
+    return version.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * A small per-thread cache of flattened dispatch lists, indexed by signal.
+ * Entries in use by an ongoing emission are pinned and never rebuilt.
+ */
+template <typename... T>
+struct fused_cache {
+    struct entry {
+        const void *owner = nullptr;
+        std::size_t pins = 0;
+        fused_list<T...> list;
+    };
+
+    fused_cache() noexcept { destroyed() = false; }
+    ~fused_cache() { destroyed() = true; }
+
+    // the cache entry dedicated to owner, or nullptr once the thread is exiting
+    static entry * get(const void *owner) noexcept {
+        if (destroyed()) {
+            return nullptr;
+        }
+        thread_local fused_cache cache;
+        const auto p = reinterpret_cast<std::uintptr_t>(owner);
+        return &cache.entries[((p >> 4) ^ (p >> 9)) % size];
+    }
+
+    static constexpr std::size_t size = 8;
+    entry entries[size];
+
+private:
+    // trivially destructible, so that it can be checked after thread exit
+    static bool & destroyed() noexcept {
+        thread_local bool d = false;
+        return d;
+    }
+};
+
+// unpins a cache entry at the end of an emission, even if a slot throws
+template <typename E>
+struct pin_guard {
+    explicit pin_guard(E *e) noexcept : entry(e) {
+        if (entry) {
+            ++entry->pins;
+        }
+    }
+
+    ~pin_guard() {
+        if (entry) {
+            --entry->pins;
+        }
+    }
+
+    pin_guard(const pin_guard &) = delete;
+    pin_guard & operator=(const pin_guard &) = delete;
+
+    E *entry;
+};
+
+/*
+ * A slot object holds state information, and a callable to to be called
+ * whenever the function call operator of its slot_base base class is called.
+ */
+template <typename Func, typename... Args>
+class slot final : public slot_base<Args...> {
+public:
+    template <typename F, typename Gid>
+    constexpr slot(cleanable &c, F && f, Gid gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>)
+        , func{std::forward<F>(f)} {}
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot*>(s);
+        self->func.value(std::forward<A>(args)...);
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    void destroy() noexcept override {
+        func.destroy();
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func.value);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func.value);
+    }
+#endif
+
+private:
+    slot_member<std::decay_t<Func>> func;
+};
+
+/*
+ * Variation of slot that prepends a connection object to the callable
+ */
+template <typename Func, typename... Args>
+class slot_extended final : public slot_base<Args...> {
+public:
+    template <typename F>
+    constexpr slot_extended(cleanable &c, F && f, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>)
+        , func{std::forward<F>(f)} {}
+
+    slot_member<connection> conn;
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_extended*>(s);
+        self->func.value(self->conn.value, std::forward<A>(args)...);
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    void destroy() noexcept override {
+        func.destroy();
+        conn.destroy();
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func.value);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func.value);
+    }
+#endif
+
+private:
+    slot_member<std::decay_t<Func>> func;
+};
+
+/*
+ * A slot object holds state information, an object and a pointer over member
+ * function to be called whenever the function call operator of its slot_base
+ * base class is called.
+ */
+template <typename Pmf, typename Ptr, typename... Args>
+class slot_pmf final : public slot_base<Args...> {
+public:
+    template <typename F, typename P>
+    constexpr slot_pmf(cleanable &c, F && f, P && p, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>)
+        , pmf{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)} {}
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_pmf*>(s);
+        auto &obj = *self->ptr;
+        const auto fn = self->pmf;
+        (obj.*fn)(std::forward<A>(args)...);
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(pmf);
+    }
+
+    obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(pmf);
+    }
+#endif
+
+private:
+    std::decay_t<Pmf> pmf;
+    std::decay_t<Ptr> ptr;
+};
+
+/*
+ * Variation of slot that prepends a connection object to the callable
+ */
+template <typename Pmf, typename Ptr, typename... Args>
+class slot_pmf_extended final : public slot_base<Args...> {
+public:
+    template <typename F, typename P>
+    constexpr slot_pmf_extended(cleanable &c, F && f, P && p, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>)
+        , pmf{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)} {}
+
+    slot_member<connection> conn;
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_pmf_extended*>(s);
+        auto &obj = *self->ptr;
+        const auto fn = self->pmf;
+        (obj.*fn)(self->conn.value, std::forward<A>(args)...);
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    void destroy() noexcept override {
+        conn.destroy();
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(pmf);
+    }
+    obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(pmf);
+    }
+#endif
+
+private:
+    std::decay_t<Pmf> pmf;
+    std::decay_t<Ptr> ptr;
+};
+
+/*
+ * An implementation of a slot that tracks the life of a supplied object
+ * through a weak pointer in order to automatically disconnect the slot
+ * on said object destruction.
+ */
+template <typename Func, typename WeakPtr, typename... Args>
+class slot_tracked final : public slot_base<Args...> {
+public:
+    template <typename F, typename P>
+    constexpr slot_tracked(cleanable &c, F && f, P && p, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>, true)
+        , func{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)}
+    {}
+
+    bool tracked_alive() const noexcept override {
+        return !ptr.expired();
+    }
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_tracked*>(s);
+        auto sp = self->ptr.lock();
+        if (!sp) {
+            self->disconnect();
+            return;
+        }
+        if (self->connected_flag_set()) {
+            self->func.value(std::forward<A>(args)...);
+        }
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    void destroy() noexcept override {
+        func.destroy();
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func.value);
+    }
+
+    obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func.value);
+    }
+#endif
+
+private:
+    slot_member<std::decay_t<Func>> func;
+    std::decay_t<WeakPtr> ptr;
+};
+
+// Same as above with extended signature
+template <typename Func, typename WeakPtr, typename... Args>
+class slot_tracked_extended final : public slot_base<Args...> {
+public:
+    template <typename F, typename P>
+    constexpr slot_tracked_extended(cleanable &c, F && f, P && p, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>, true)
+        , func{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)}
+    {}
+
+    slot_member<connection> conn;
+
+    bool tracked_alive() const noexcept override {
+        return !ptr.expired();
+    }
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_tracked_extended*>(s);
+        auto sp = self->ptr.lock();
+        if (!sp) {
+            self->disconnect();
+            return;
+        }
+        if (self->connected_flag_set()) {
+            self->func.value(self->conn.value, std::forward<A>(args)...);
+        }
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    void destroy() noexcept override {
+        func.destroy();
+        conn.destroy();
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func.value);
+    }
+
+    obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func.value);
+    }
+#endif
+
+private:
+    slot_member<std::decay_t<Func>> func;
+    std::decay_t<WeakPtr> ptr;
+};
+
+/*
+ * An implementation of a slot as a pointer over member function, that tracks
+ * the life of a supplied object through a weak pointer in order to automatically
+ * disconnect the slot on said object destruction.
+ */
+template <typename Pmf, typename WeakPtr, typename... Args>
+class slot_pmf_tracked final : public slot_base<Args...> {
+public:
+    template <typename F, typename P>
+    constexpr slot_pmf_tracked(cleanable &c, F && f, P && p, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>, true)
+        , pmf{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)}
+    {}
+
+    bool tracked_alive() const noexcept override {
+        return !ptr.expired();
+    }
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_pmf_tracked*>(s);
+        auto sp = self->ptr.lock();
+        if (!sp) {
+            self->disconnect();
+            return;
+        }
+        if (self->connected_flag_set()) {
+            auto &obj = *sp;
+            const auto fn = self->pmf;
+            (obj.*fn)(std::forward<A>(args)...);
+        }
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(pmf);
+    }
+
+    obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(pmf);
+    }
+#endif
+
+private:
+    std::decay_t<Pmf> pmf;
+    std::decay_t<WeakPtr> ptr;
+};
+
+// same as above with extended signature
+template <typename Pmf, typename WeakPtr, typename... Args>
+class slot_pmf_tracked_extended final : public slot_base<Args...> {
+public:
+    template <typename F, typename P>
+    constexpr slot_pmf_tracked_extended(cleanable &c, F && f, P && p, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>, true)
+        , pmf{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)}
+    {}
+
+    slot_member<connection> conn;
+
+    bool tracked_alive() const noexcept override {
+        return !ptr.expired();
+    }
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_pmf_tracked_extended*>(s);
+        auto sp = self->ptr.lock();
+        if (!sp) {
+            self->disconnect();
+            return;
+        }
+        if (self->connected_flag_set()) {
+            auto &obj = *sp;
+            const auto fn = self->pmf;
+            (obj.*fn)(self->conn.value, std::forward<A>(args)...);
+        }
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    void destroy() noexcept override {
+        conn.destroy();
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(pmf);
+    }
+
+    obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(pmf);
+    }
+#endif
+
+private:
+    std::decay_t<Pmf> pmf;
+    std::decay_t<WeakPtr> ptr;
+};
+
+/*
+ * A slot object holds state information, a pointer over member function and
+ * a trackable object, which is only called while alive.
+ */
+template <typename Pmf, typename Ptr, typename... Args>
+class slot_pmf_trackable final : public slot_base<Args...> {
+public:
+    template <typename F, typename P>
+    slot_pmf_trackable(cleanable &c, F && f, P && p, trackable_state &st, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>)
+        , pmf{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)}
+        , state{(st.retain(), &st)}
+    {}
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_pmf_trackable*>(s);
+        trackable_call call(*self->state);
+        if (call.alive()) {
+            auto &obj = *self->ptr;
+            const auto fn = self->pmf;
+            (obj.*fn)(std::forward<A>(args)...);
+        }
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(pmf);
+    }
+
+    obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(pmf);
+    }
+#endif
+
+private:
+    std::decay_t<Pmf> pmf;
+    std::decay_t<Ptr> ptr;
+    intrusive_ptr<trackable_state> state;
+};
+
+/*
+ * A slot object holds state information, a callable and a pointer to a
+ * trackable object, the callable being only called while the object is alive.
+ */
+template <typename Func, typename Ptr, typename... Args>
+class slot_trackable final : public slot_base<Args...> {
+public:
+    template <typename F, typename P>
+    slot_trackable(cleanable &c, F && f, P && p, trackable_state &st, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>)
+        , func{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)}
+        , state{(st.retain(), &st)}
+    {}
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_trackable*>(s);
+        trackable_call call(*self->state);
+        if (call.alive()) {
+            self->func.value(std::forward<A>(args)...);
+        }
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    void destroy() noexcept override {
+        func.destroy();
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func.value);
+    }
+
+    obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func.value);
+    }
+#endif
+
+private:
+    slot_member<std::decay_t<Func>> func;
+    std::decay_t<Ptr> ptr;
+    intrusive_ptr<trackable_state> state;
+};
+
+/*
+ * A call of a queued slot, holding a strong reference to the slot, which keeps
+ * its callable alive, along with a copy of the emission arguments.
+ */
+template <typename Slot, typename... A>
+class queued_slot_call final : public queued_call {
+public:
+    template <typename... U>
+    explicit queued_slot_call(Slot *s, U && ...a)
+        : queued_call(&run)
+        , slot{(s->retain(), s)}
+        , args{std::forward<U>(a)...}
+    {}
+
+private:
+    static void run(queued_call *c, bool invoke) {
+        std::unique_ptr<queued_slot_call> self{static_cast<queued_slot_call *>(c)};
+        if (invoke) {
+            self->slot->invoke(self->args, std::index_sequence_for<A...>{});
+        }
+    }
+
+    intrusive_ptr<Slot> slot;
+    std::tuple<A...> args;
+};
+
+/*
+ * A slot whose calls are posted to an event queue, which runs them later on
+ * unless the slot got disconnected or blocked in the meantime.
+ */
+template <typename Func, typename... Args>
+class slot_queued final : public slot_base<Args...> {
+public:
+    template <typename F>
+    constexpr slot_queued(cleanable &c, F && f, event_queue &q, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>)
+        , func{std::forward<F>(f)}
+        , queue{&q}
+    {}
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_queued*>(s);
+        self->queue->post(new call_type(self, std::forward<A>(args)...));
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    void destroy() noexcept override {
+        func.destroy();
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func.value);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func.value);
+    }
+#endif
+
+private:
+    using call_type = queued_slot_call<slot_queued, std::decay_t<Args>...>;
+    friend call_type;
+
+    template <typename Tuple, std::size_t... I>
+    void invoke(Tuple &args, std::index_sequence<I...>) {
+        if (slot_state::callable()) {
+            func.value(std::get<I>(args)...);
+        }
+    }
+
+    slot_member<std::decay_t<Func>> func;
+    event_queue *queue;
+};
+
+/*
+ * A queued slot that tracks the life of a supplied object, both when posting
+ * a call and when running it.
+ */
+template <typename Func, typename WeakPtr, typename... Args>
+class slot_queued_tracked final : public slot_base<Args...> {
+public:
+    template <typename F, typename P>
+    constexpr slot_queued_tracked(cleanable &c, F && f, P && p, event_queue &q, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>, true)
+        , func{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)}
+        , queue{&q}
+    {}
+
+    bool tracked_alive() const noexcept override {
+        return !ptr.expired();
+    }
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_queued_tracked*>(s);
+        if (self->ptr.expired()) {
+            self->disconnect();
+            return;
+        }
+        self->queue->post(new call_type(self, std::forward<A>(args)...));
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    void destroy() noexcept override {
+        func.destroy();
+    }
+
+    func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func.value);
+    }
+
+    obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func.value);
+    }
+#endif
+
+private:
+    using call_type = queued_slot_call<slot_queued_tracked, std::decay_t<Args>...>;
+    friend call_type;
+
+    template <typename Tuple, std::size_t... I>
+    void invoke(Tuple &args, std::index_sequence<I...>) {
+        auto sp = ptr.lock();
+        if (!sp) {
+            this->disconnect();
+            return;
+        }
+        if (slot_state::callable()) {
+            func.value(std::get<I>(args)...);
+        }
+    }
+
+    slot_member<std::decay_t<Func>> func;
+    std::decay_t<WeakPtr> ptr;
+    event_queue *queue;
+};
+
+/*
+ * A slot chaining a signal to another one with the same argument types, whose
+ * slots get fused into the flattened dispatch list of the former. Calling it
+ * the usual way emits the target signal.
+ */
+template <typename Signal, typename... Args>
+class slot_fused final : public slot_base<Args...> {
+public:
+    constexpr slot_fused(cleanable &c, Signal &sig, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>)
+        , target{&sig}
+    {}
+
+    bool fuse(fused_list<Args...> &l) const override {
+        target->flatten_into(l);
+        return true;
+    }
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        (*static_cast<slot_fused*>(s)->target)(std::forward<A>(args)...);
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        target->emit_move(std::forward<arg_move_t<Args>>(args)...);
+    }
+
+    obj_ptr get_object() const noexcept override {
+        return get_object_ptr(target);
+    }
+
+private:
+    Signal *target;
+};
+
+#ifdef SIGSLOT_COROUTINES_ENABLED
+/*
+ * A one-shot slot resuming a coroutine suspended on a signal_awaiter. The
+ * first emission to disconnect the slot wins the right to resume it.
+ */
+template <typename Awaiter, typename... Args>
+class slot_awaiting final : public slot_base<Args...> {
+public:
+    constexpr slot_awaiting(cleanable &c, Awaiter &a, group_id gid)
+        : slot_base<Args...>(c, gid, &call_slot<arg_pass_t<Args>...>)
+        , awaiter{&a}
+    {}
+
+protected:
+    template <typename... A>
+    static void call_slot(slot_base<Args...> *s, A ...args) {
+        auto *self = static_cast<slot_awaiting*>(s);
+        if (self->disconnect()) {
+            self->awaiter->resume(std::forward<A>(args)...);
+        }
+    }
+
+    void call_move(arg_move_t<Args> ...args) override {
+        call_slot<arg_move_t<Args>...>(this, std::forward<arg_move_t<Args>>(args)...);
+    }
+
+private:
+    Awaiter *awaiter;
+};
+#endif
+
+/*
+ * A vector of fixed capacity N, whose elements are stored inline. Only the
+ * operations slot_list needs are provided, and insertion requires room left.
+ */
+template <typename T, std::size_t N>
+class inplace_vector {
+public:
+    using value_type = T;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    iterator begin() noexcept { return m_data.data(); }
+    iterator end() noexcept { return m_data.data() + m_size; }
+    const_iterator begin() const noexcept { return m_data.data(); }
+    const_iterator end() const noexcept { return m_data.data() + m_size; }
+    std::size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    bool full() const noexcept { return m_size == N; }
+
+    T & operator[](std::size_t i) noexcept { return m_data[i]; }
+    const T & operator[](std::size_t i) const noexcept { return m_data[i]; }
+
+    iterator insert(const_iterator pos, T &&v) noexcept {
+        auto *p = begin() + (pos - begin());
+        std::move_backward(p, end(), end() + 1);
+        *p = std::move(v);
+        ++m_size;
+        return p;
+    }
+
+    iterator erase(const_iterator pos) noexcept {
+        return erase(pos, pos + 1);
+    }
+
+    // the elements left past the end are reset, to release what they hold
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        auto *f = begin() + (first - begin());
+        auto *l = begin() + (last - begin());
+        auto *e = std::move(l, end(), f);
+        std::fill(e, end(), T{});
+        m_size -= std::size_t(l - f);
+        return f;
+    }
+
+    void clear() noexcept {
+        erase(begin(), end());
+    }
+
+private:
+    std::array<T, N> m_data{};
+    std::size_t m_size = 0;
+};
+
+template <typename T, std::size_t N>
+using slot_vector = std::conditional_t<N == 0, std::vector<T, resource_allocator<T>>,
+                                       inplace_vector<T, N>>;
+
+/*
+ * slot_list stores the slots of a signal in a single contiguous array kept
+ * sorted by ascending group id, so that emission is a linear scan. Groups are
+ * delimited by the offsets of their end in this array, and slots remember
+ * their position in it. Groups are looked up by binary search, and removed as
+ * soon as they become empty.
+ *
+ * The order of the slots inside a group being unspecified, adding or removing
+ * a slot only moves one slot of each of the following groups, from one end of
+ * the group to the other, rather than shifting the whole tail of the array.
+ * This costs a constant amount of work per group, however many slots there
+ * are. Slots added to the last group keep their connection order.
+ *
+ * A non zero Capacity stores up to Capacity slots inline, the caller making
+ * sure never to add more.
+ */
+template <typename Ptr, std::size_t Capacity = 0>
+class slot_list {
+    struct group_type { group_id gid; std::size_t end; };
+
+public:
+    using allocator_type = resource_allocator<Ptr>;
+
+private:
+    using slots_type = slot_vector<Ptr, Capacity>;
+    using groups_type = slot_vector<group_type, Capacity>;
+
+public:
+    using const_iterator = typename slots_type::const_iterator;
+
+    slot_list() = default;
+
+    explicit slot_list(const allocator_type &alloc)
+        : m_slots(alloc)
+        , m_groups(alloc)
+    {}
+
+    allocator_type get_allocator() const noexcept {
+        return m_slots.get_allocator();
+    }
+
+    const_iterator begin() const noexcept { return m_slots.begin(); }
+    const_iterator end() const noexcept { return m_slots.end(); }
+    std::size_t size() const noexcept { return m_slots.size(); }
+    bool empty() const noexcept { return m_slots.empty(); }
+
+    // append a slot to the group it belongs to
+    void add(Ptr &&s) {
+        const group_id gid = s->group();
+
+        // find the group, or create it, no empty group taking up room
+        auto it = lower_bound(gid);
+        if (it == m_groups.end() || it->gid != gid) {
+            it = m_groups.insert(it, {gid, group_begin(it)});
+        }
+
+        // the first slot of each following group moves to the room made at
+        // the end of its group, from the end of the array down to the group
+        // of the new slot, whose end is then free
+        m_slots.insert(m_slots.end(), Ptr{});
+        std::size_t hole = m_slots.size() - 1;
+        for (auto g = m_groups.end(); --g != it;) {
+            const auto first = group_begin(g);
+            move_slot(first, hole);
+            hole = first;
+            ++g->end;
+        }
+
+        s->index() = hole;
+        m_slots[hole] = std::move(s);
+        ++it->end;
+    }
+
+    // append the slots of a random access range to the groups they belong to,
+    // keeping their relative order within a group
+    template <typename It>
+    void add_range(It first, It last) {
+        add_range(first, last, std::integral_constant<bool, Capacity == 0>{});
+    }
+
+    // tell whether a slot belongs to the list
+    bool contains(const slot_state *state) const noexcept {
+        const auto idx = state->index();
+        return idx < m_slots.size() && m_slots[idx].get() == state;
+    }
+
+    // remove a slot if it still belongs to the list
+    bool remove(const slot_state *state) {
+        // ensure we have the right slot, in case of concurrent cleaning
+        if (!contains(state)) {
+            return false;
+        }
+
+        // the last slot of the group takes the place of the removed one, and
+        // the last slot of each following group fills the hole left at the
+        // beginning of its group, until the hole reaches the end of the array
+        auto it = lower_bound(state->group());
+        std::size_t hole = state->index();
+        for (auto g = it; g != m_groups.end(); ++g) {
+            const auto last = g->end - 1;
+            move_slot(last, hole);
+            hole = last;
+            --g->end;
+        }
+        m_slots.erase(m_slots.end() - 1);
+
+        if (it->end == group_begin(it)) {
+            m_groups.erase(it);
+        }
+        return true;
+    }
+
+    // remove all the slots of a group, fn is called on each of them beforehand
+    template <typename Fn>
+    std::size_t remove_group(group_id gid, Fn && fn) {
+        auto it = find_group(gid);
+        if (it == m_groups.end()) {
+            return 0;
+        }
+
+        const auto b = m_slots.begin() + std::ptrdiff_t(group_begin(it));
+        const auto e = m_slots.begin() + std::ptrdiff_t(it->end);
+        const auto count = std::size_t(e - b);
+        std::for_each(b, e, fn);
+        const auto first = m_slots.erase(b, e);
+        shift_ends(it, -std::ptrdiff_t(count));
+        m_groups.erase(it);
+
+        // the slots of the following groups moved
+        for (auto i = first; i != m_slots.end(); ++i) {
+            (*i)->index() = std::size_t(i - m_slots.begin());
+        }
+        return count;
+    }
+
+    // remove the slots matching a condition, and the groups left empty, in a
+    // single pass
+    template <typename Cond>
+    std::size_t remove_if(Cond && cond) {
+        std::size_t in = 0;
+        std::size_t out = 0;
+        std::size_t groups = 0;
+
+        for (std::size_t g = 0; g < m_groups.size(); ++g) {
+            const auto group = m_groups[g];
+            const auto out_begin = out;
+
+            for (; in < group.end; ++in) {
+                if (cond(m_slots[in])) {
+                    continue;
+                }
+                // only touch the slots whose position changed
+                if (out != in) {
+                    m_slots[out] = std::move(m_slots[in]);
+                    m_slots[out]->index() = out;
+                }
+                ++out;
+            }
+
+            if (out != out_begin) {
+                m_groups[groups++] = {group.gid, out};
+            }
+        }
+
+        const auto count = m_slots.size() - out;
+        m_slots.erase(m_slots.begin() + std::ptrdiff_t(out), m_slots.end());
+        m_groups.erase(m_groups.begin() + std::ptrdiff_t(groups), m_groups.end());
+        return count;
+    }
+
+    void clear() noexcept {
+        m_slots.clear();
+        m_groups.clear();
+    }
+
+    // call fn with the range of slots of each group, in ascending group order
+    template <typename Fn>
+    void for_each_group(Fn && fn) const {
+        for (auto it = m_groups.begin(); it != m_groups.end(); ++it) {
+            const auto b = m_slots.begin() + std::ptrdiff_t(group_begin(it));
+            const auto e = m_slots.begin() + std::ptrdiff_t(it->end);
+            if (b != e) {
+                fn(b, e);
+            }
+        }
+    }
+
+private:
+    // fixed capacity lists are small, slots get added one by one
+    template <typename It>
+    void add_range(It first, It last, std::false_type) {
+        for (; first != last; ++first) {
+            add(std::move(*first));
+        }
+    }
+
+    // merge the new slots, sorted by group, with the existing ones in one pass
+    template <typename It>
+    void add_range(It first, It last, std::true_type) {
+        if (first == last) {
+            return;
+        }
+
+        std::stable_sort(first, last, [] (const Ptr &a, const Ptr &b) {
+            return a->group() < b->group();
+        });
+
+        // the new group list, the new slots of a group going after the
+        // existing ones
+        groups_type groups(m_groups.get_allocator());
+        groups.reserve(m_groups.size() + std::size_t(last - first));
+        std::size_t end = 0;
+        auto og = m_groups.begin();
+        for (auto n = first; og != m_groups.end() || n != last;) {
+            const bool has_old = og != m_groups.end() &&
+                                 (n == last || og->gid <= (*n)->group());
+            const group_id gid = has_old ? og->gid : (*n)->group();
+            std::size_t size = 0;
+            if (has_old) {
+                size = og->end - group_begin(og);
+                ++og;
+            }
+            for (; n != last && (*n)->group() == gid; ++n) {
+                ++size;
+            }
+            end += size;
+            groups.push_back({gid, end});
+        }
+
+        // move the slots to their place, from the last group to the first one,
+        // which never overwrites slots yet to be moved
+        m_slots.resize(end);
+        auto n = last;
+        og = m_groups.end();
+        for (auto it = groups.end(); it != groups.begin();) {
+            --it;
+            auto d = it->end;
+            for (; n != first && (*std::prev(n))->group() == it->gid; --d) {
+                m_slots[d - 1] = std::move(*--n);
+            }
+            if (og != m_groups.begin() && std::prev(og)->gid == it->gid) {
+                --og;
+                std::move_backward(m_slots.begin() + std::ptrdiff_t(group_begin(og)),
+                                   m_slots.begin() + std::ptrdiff_t(og->end),
+                                   m_slots.begin() + std::ptrdiff_t(d));
+            }
+        }
+
+        m_groups = std::move(groups);
+        for (std::size_t i = 0; i < m_slots.size(); ++i) {
+            m_slots[i]->index() = i;
+        }
+    }
+
+    std::size_t group_begin(typename groups_type::const_iterator it) const noexcept {
+        return it == m_groups.begin() ? 0 : std::prev(it)->end;
+    }
+
+    // the first group whose id is not lower than gid
+    typename groups_type::iterator lower_bound(group_id gid) noexcept {
+        return std::lower_bound(m_groups.begin(), m_groups.end(), gid,
+                                [] (const group_type &g, group_id id) { return g.gid < id; });
+    }
+
+    typename groups_type::const_iterator lower_bound(group_id gid) const noexcept {
+        return std::lower_bound(m_groups.begin(), m_groups.end(), gid,
+                                [] (const group_type &g, group_id id) { return g.gid < id; });
+    }
+
+    typename groups_type::iterator find_group(group_id gid) noexcept {
+        auto it = lower_bound(gid);
+        return it != m_groups.end() && it->gid == gid ? it : m_groups.end();
+    }
+
+    // move a slot to another position, the slot there being released
+    void move_slot(std::size_t from, std::size_t to) noexcept {
+        if (from != to) {
+            m_slots[to] = std::move(m_slots[from]);
+            m_slots[to]->index() = to;
+        }
+    }
+
+    // offset the end of a group and all the following ones
+    void shift_ends(typename groups_type::iterator it, std::ptrdiff_t delta) noexcept {
+        for (; it != m_groups.end(); ++it) {
+            it->end = std::size_t(std::ptrdiff_t(it->end) + delta);
+        }
+    }
+
+private:
+    slots_type m_slots;     // all the slots, sorted by group
+    groups_type m_groups;   // kept ordered by ascending gid
+};
+
+} // namespace detail
+
+
+/**
+ * A pool of worker threads used by signal_base::emit_parallel() to run the
+ * slots of a group concurrently.
+ *
+ * The calling thread takes part in the work, so that a pool of n threads runs
+ * up to n+1 slots at once. Groups of fewer slots than a threshold, for which
+ * the synchronization would outweigh the gain, are run serially. A pool runs
+ * one group at a time, a group submitted while the pool is busy, including
+ * from a slot running on the pool, is run serially on the calling thread.
+ */
+class emission_pool {
+public:
+    /**
+     * @param threads the number of worker threads
+     * @param threshold the minimum number of slots of a group to run it in parallel
+     */
+    explicit emission_pool(std::size_t threads = default_thread_count(),
+                           std::size_t threshold = 16)
+        : m_threshold(threshold)
+    {
+        m_threads.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            m_threads.emplace_back([this] { work(); });
+        }
+    }
+
+    ~emission_pool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto &t : m_threads) {
+            t.join();
+        }
+    }
+
+    emission_pool(const emission_pool &) = delete;
+    emission_pool & operator=(const emission_pool &) = delete;
+
+    std::size_t thread_count() const noexcept {
+        return m_threads.size();
+    }
+
+    std::size_t threshold() const noexcept {
+        return m_threshold;
+    }
+
+    /**
+     * Call fn(i) for every i in [0, n), on the worker threads and the calling
+     * thread, and return once all the calls are done. The first exception
+     * thrown by a call is rethrown once the others are over.
+     */
+    template <typename Fn>
+    void run(std::size_t n, Fn && fn) {
+        std::unique_lock<std::mutex> busy(m_busy, std::try_to_lock);
+        if (!busy || n < m_threshold || m_threads.empty()) {
+            for (std::size_t i = 0; i < n; ++i) {
+                fn(i);
+            }
+            return;
+        }
+
+        auto call = [] (void *f, std::size_t i) {
+            (*static_cast<std::remove_reference_t<Fn> *>(f))(i);
+        };
+
+        // a few chunks per thread balance the load
+        const auto parts = 4 * (m_threads.size() + 1);
+        job j{call, std::addressof(fn), n, (n + parts - 1) / parts};
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_job = &j;
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        j.execute();
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this] { return m_active == 0; });
+            m_job = nullptr;
+        }
+
+        if (j.error) {
+            std::rethrow_exception(j.error);
+        }
+    }
+
+private:
+    static std::size_t default_thread_count() noexcept {
+        const auto n = std::thread::hardware_concurrency();
+        return n > 1 ? n - 1 : 0;
+    }
+
+    // calls to be dispatched, indices are handed out by chunks
+    struct job {
+        job(void (*c)(void *, std::size_t), void *f, std::size_t n, std::size_t k) noexcept
+            : call(c), fn(f), size(n), chunk(k)
+        {}
+
+        void execute() noexcept {
+            for (;;) {
+                const auto b = next.fetch_add(chunk, std::memory_order_relaxed);
+                if (b >= size) {
+                    return;
+                }
+                const auto e = b + chunk < size ? b + chunk : size;
+                for (auto i = b; i < e; ++i) {
+                    try {
+                        call(fn, i);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!error) {
+                            error = std::current_exception();
+                        }
+                    }
+                }
+            }
+        }
+
+        void (*call)(void *, std::size_t);
+        void *fn;
+        const std::size_t size;
+        const std::size_t chunk;
+        std::atomic<std::size_t> next{0};
+        std::mutex error_mutex;
+        std::exception_ptr error;
+    };
+
+    void work() {
+        std::uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;) {
+            m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+            if (m_stop) {
+                return;
+            }
+            seen = m_generation;
+
+            // the job may be over already
+            auto *j = m_job;
+            if (!j) {
+                continue;
+            }
+
+            ++m_active;
+            lock.unlock();
+            j->execute();
+            lock.lock();
+            if (--m_active == 0) {
+                m_done.notify_all();
+            }
+        }
+    }
+
+private:
+    const std::size_t m_threshold;
+    std::mutex m_busy;                  // held while running a job
+    std::mutex m_mutex;                 // protects the fields below
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    job *m_job = nullptr;
+    std::uint64_t m_generation = 0;
+    std::size_t m_active = 0;
+    bool m_stop = false;
+    std::vector<std::thread> m_threads;
+};
+
+
+#ifdef SIGSLOT_COROUTINES_ENABLED
+/**
+ * An awaitable object, returned by signal_base::next(), that suspends the
+ * awaiting coroutine until the next emission of a signal.
+ *
+ * The coroutine is resumed on the emitting thread with a copy of the emitted
+ * arguments: nothing for signals without argument, the argument itself for
+ * single argument signals, and a std::tuple of them otherwise.
+ *
+ * Awaiting registers a one-shot slot, allocated from the slot pool of the
+ * signal, which disconnects itself on emission. Should the awaiter be destroyed
+ * before that, along with the frame of a suspended coroutine, the slot gets
+ * disconnected. A signal destroyed meanwhile never resumes the coroutine.
+ */
+template <typename Lockable, typename... T>
+class signal_awaiter {
+    using signal_type = signal_base<Lockable, T...>;
+    using slot_type = detail::slot_awaiting<signal_awaiter, T...>;
+    using value_type = std::tuple<std::decay_t<T>...>;
+
+public:
+    signal_awaiter(const signal_awaiter &) = delete;
+    signal_awaiter & operator=(const signal_awaiter &) = delete;
+
+    ~signal_awaiter() {
+        if (m_slot) {
+            m_slot->disconnect();
+        }
+    }
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    // throws std::bad_alloc if the signal has no room left for the slot
+    void await_suspend(std::coroutine_handle<> h) {
+        m_handle = h;
+        m_sig->template connect_slot_awaiting<slot_type>(*this, m_gid, m_slot);
+    }
+
+    decltype(auto) await_resume() {
+        if constexpr (sizeof...(T) == 1) {
+            return std::get<0>(std::move(*m_value));
+        } else if constexpr (sizeof...(T) > 1) {
+            return std::move(*m_value);
+        }
+    }
+
+private:
+    friend signal_type;
+    friend slot_type;
+
+    signal_awaiter(signal_type &sig, group_id gid) noexcept
+        : m_sig{&sig}
+        , m_gid{gid}
+    {}
+
+    template <typename... U>
+    void resume(U && ...a) {
+        m_value.emplace(std::forward<U>(a)...);
+        m_handle.resume();
+    }
+
+private:
+    signal_type *m_sig;
+    group_id m_gid;
+    detail::slot_handle m_slot;
+    std::coroutine_handle<> m_handle;
+    std::optional<value_type> m_value;
+};
+#endif
+
+/**
+ * signal_base is an implementation of the observer pattern, through the use
+ * of an emitting object and slots that are connected to the signal and called
+ * with supplied arguments when a signal is emitted.
+ *
+ * signal_base is the general implementation, whose locking policy must be
+ * set in order to decide thread safety guarantees. signal and signal_st
+ * are partial specializations for multi-threaded and single-threaded use.
+ *
+ * It does not allow slots to return a value.
+ *
+ * Slot execution order can be constrained by assigning group ids to the slots.
+ * The execution order of slots in a same group is unspecified and should not be
+ * relied upon, however groups are executed in ascending group ids order. When
+ * the group id of a slot is not set, it is assigned to the group 0. Group ids
+ * can have any value in the range of signed 32 bit integers.
+ *
+ * @tparam Lockable a lock type to decide the lock policy
+ * @tparam T... the argument types of the emitting and slots functions.
+ */
+template <typename Lockable, typename... T>
+class signal_base final : public detail::cleanable {
+#ifdef SIGSLOT_COROUTINES_ENABLED
+    friend class signal_awaiter<Lockable, T...>;
+#endif
+    template <typename, typename...>
+    friend class detail::slot_fused;
+
+    template <typename U, typename L>
+    using cow_type = typename detail::cow_traits<U, L>::type;
+
+    template <typename U, typename L>
+    using cow_copy_type = typename detail::cow_traits<U, L>::copy_type;
+
+    using lock_type = std::unique_lock<Lockable>;
+    using slot_base = detail::slot_base<T...>;
+    using slot_ptr = detail::slot_ptr<T...>;
+    using list_type = detail::slot_list<slot_ptr, detail::slot_capacity<Lockable>::value>;
+    using pool_type = detail::slot_pool_holder<Lockable>;
+    using index_type = detail::slot_index<slot_base>;
+
+public:
+    using arg_list = trait::typelist<T...>;
+    using ext_arg_list = trait::typelist<connection&, T...>;
+
+    signal_base() noexcept(std::is_nothrow_default_constructible<pool_type>::value)
+        : m_block(false)
+    {}
+
+#ifdef SIGSLOT_PMR_ENABLED
+    /**
+     * Construct a signal whose slots and slot lists are allocated from a memory
+     * resource, which must outlive the signal and the connections made to it.
+     * With a thread-safe signal, the resource must be thread-safe as well.
+     *
+     * @param resource the memory resource to allocate from
+     */
+    explicit signal_base(std::pmr::memory_resource *resource)
+        : m_slots(list_type(detail::resource_allocator<slot_ptr>(resource)))
+        , m_block(false)
+        , m_pool(resource)
+        , m_resource(resource)
+    {}
+#endif
+    ~signal_base() override {
+        if (m_max_depth.load(std::memory_order_relaxed) > 0) {
+            detail::trampoline::local().drop(this);
+        }
+        disconnect_all();
+    }
+
+    signal_base(const signal_base&) = delete;
+    signal_base & operator=(const signal_base&) = delete;
+
+    signal_base(signal_base && o) /* not noexcept */
+        : m_block{o.m_block.load()}
+        , m_fused{o.m_fused.load()}
+        , m_max_depth{o.m_max_depth.load()}
+        , m_pool{std::move(o.m_pool)}
+        , m_resource{o.m_resource}
+    {
+        lock_type lock(o.m_mutex);
+        using std::swap;
+        swap(m_slots, o.m_slots);
+        swap(m_index, o.m_index);
+        m_tombstones.store(o.m_tombstones.exchange(0));
+        o.publish();
+    }
+
+    signal_base & operator=(signal_base && o) /* not noexcept */ {
+        lock_type lock1(m_mutex, std::defer_lock);
+        lock_type lock2(o.m_mutex, std::defer_lock);
+        std::lock(lock1, lock2);
+
+        using std::swap;
+        swap(m_slots, o.m_slots);
+        swap(m_index, o.m_index);
+        m_tombstones.store(o.m_tombstones.exchange(m_tombstones.load()));
+        m_block.store(o.m_block.exchange(m_block.load()));
+        m_fused.store(o.m_fused.load() || m_fused.load());
+        o.m_fused.store(m_fused.load());
+        m_max_depth.store(o.m_max_depth.exchange(m_max_depth.load()));
+        m_pool.swap(o.m_pool);
+        swap(m_resource, o.m_resource);
+        publish();
+        o.publish();
+        return *this;
+    }
+
+    /**
      * Emit a signal
      *
-     * Effect: All non blocked and connected slot functions will be called
-     *         with supplied arguments.
-     * Safety: With proper locking (see pal::signal), emission can happen from
-     *         multiple threads simultaneously. The guarantees only apply to the
-     *         signal object, it does not cover thread safety of potentially
-     *         shared state used in slot functions.
+     * Effect: All non blocked and connected slot functions will be called
+     *         with supplied arguments.
+     * Safety: With proper locking (see pal::signal), emission can happen from
+     *         multiple threads simultaneously. The guarantees only apply to the
+     *         signal object, it does not cover thread safety of potentially
+     *         shared state used in slot functions.
+     *
+     * @param a... arguments to emit
+     */
+    template <typename... U>
+    void operator()(U && ...a) const {
+        if (m_block) {
+            return;
+        }
+
+        emit_plain(detail::deferrable<T...>{}, a...);
+    }
+
+    /**
+     * Emit a signal, moving the arguments into the last slot
+     *
+     * Effect: Same as emission, except that the last connected and non
+     *         blocked slot gets rvalue arguments, which it may move from,
+     *         instead of lvalues. Arguments supplied as lvalues are copied
+     *         for that slot.
+     * Safety: Same as emission. A slot disconnected or blocked by another
+     *         thread after being picked as the last one is not called.
+     *
+     * @param a... arguments to emit
+     */
+    template <typename... U>
+    void emit_move(U && ...a) const {
+        if (m_block) {
+            return;
+        }
+
+        cow_copy_type<list_type, Lockable> ref = slots_reference();
+        const auto &slots = detail::cow_read(ref);
+
+        auto last = slots.end();
+        for (auto it = slots.end(); it != slots.begin();) {
+            --it;
+            if ((*it)->connected() && !(*it)->blocked()) {
+                last = it;
+                break;
+            }
+        }
+
+        for (auto it = slots.begin(); it != last; ++it) {
+            (*it)->operator()(a...);
+        }
+
+        if (last != slots.end()) {
+            (*last)->call_moving(detail::move_arg<T>(std::forward<U>(a))...);
+        }
+    }
+
+    /**
+     * Emit a signal, running the slots of each group concurrently
+     *
+     * Effect: Same as emission, except that the slots of a group are run on
+     *         the threads of an emission pool. Groups are still run in
+     *         ascending group id order, each one starting once the previous
+     *         one is done, and the call returns when every slot has run.
+     *         Groups smaller than the threshold of the pool are run serially
+     *         on the calling thread.
+     * Safety: Same as emission. The slots of a group and the arguments they
+     *         share must support concurrent calls.
+     *
+     * @param pool the emission pool to run the slots on
+     * @param a... arguments to emit
+     */
+    template <typename... U>
+    void emit_parallel(emission_pool &pool, U && ...a) const {
+        if (m_block) {
+            return;
+        }
+
+        cow_copy_type<list_type, Lockable> ref = slots_reference();
+
+        detail::cow_read(ref).for_each_group([&] (auto b, auto e) {
+            pool.run(std::size_t(e - b), [&] (std::size_t i) {
+                b[std::ptrdiff_t(i)]->operator()(a...);
+            });
+        });
+    }
+
+    /**
+     * Emit a signal once for each item of a range
+     *
+     * Effect: Same as emitting the signal for each item in turn, except that
+     *         the slots are looked up only once, and that every slot is called
+     *         for all the items before the next slot, which keeps it hot in
+     *         cache. Slots are still called in ascending group id order.
+     * Safety: Same as emission.
+     *
+     * Items are the arguments themselves for single argument signals, and
+     * tuple-like objects of arguments, such as std::tuple, otherwise.
+     *
+     * @param items a range of items, traversed once per slot
+     */
+    template <typename Range>
+    void emit_batch(Range && items) const {
+        if (m_block) {
+            return;
+        }
+
+        cow_copy_type<list_type, Lockable> ref = slots_reference();
+
+        for (const auto &s : detail::cow_read(ref)) {
+            for (auto &&item : items) {
+                detail::call_with_item<sizeof...(T)>(*s, item);
+            }
+        }
+    }
+
+    /**
+     * Connect a callable of compatible arguments.
+     *
+     * Effect: Creates and stores a new slot responsible for executing the
+     *         supplied callable for every subsequent signal emission.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @param c a callable
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable>
+    std::enable_if_t<trait::is_callable_v<arg_list, Callable>, connection>
+    connect(Callable && c, group_id gid = 0) {
+        using slot_t = detail::slot<Callable, T...>;
+        return connect_slot<slot_t>(std::forward<Callable>(c), gid);
+    }
+
+    /**
+     * Connect a range of callables of compatible arguments at once.
+     *
+     * Effect: Same as connecting each callable in turn, except that the lock
+     *         is only taken once, the slot list copied at most once and the
+     *         new slots merged into the groups in a single pass, which makes
+     *         wiring many slots much cheaper. The callables are moved from if
+     *         the range is an rvalue.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @param callables a range of callables
+     * @param gid an identifier that can be used to order slot execution
+     * @return the connection objects, in the order of the callables
+     */
+    template <typename Range>
+    std::vector<connection> connect_many(Range && callables, group_id gid = 0) {
+        using item_type = decltype(*std::begin(callables));
+        using callable_type = std::decay_t<item_type>;
+        static_assert(trait::is_callable_v<arg_list, callable_type>,
+                      "the range must hold callables of compatible arguments");
+        using forward_type = std::conditional_t<
+            !std::is_lvalue_reference<Range>::value &&
+            !std::is_const<std::remove_reference_t<item_type>>::value,
+            callable_type &&, item_type>;
+        using slot_t = detail::slot<callable_type, T...>;
+
+        std::vector<slot_ptr> slots;
+        std::vector<connection> conns;
+        for (auto &&c : callables) {
+            auto s = make_slot<slot_t>(static_cast<forward_type>(c), gid);
+            conns.push_back(connection(detail::slot_handle{s.get()}));
+            if (s) {
+                slots.push_back(std::move(s));
+            }
+        }
+
+        // nothing to publish, which would invalidate the cached lists
+        if (slots.empty()) {
+            return conns;
+        }
+
+        lock_type lock(m_mutex);
+        auto &list = write_slots();
+        index_slots(slots.begin(), slots.end(), [&] {
+            list.add_range(slots.begin(), slots.end());
+        });
+        publish();
+        return conns;
+    }
+
+    /**
+     * Connect a callable with an additional connection argument.
+     *
+     * The callable's first argument must be of type connection. The callable
+     * can manage its own connection through this argument.
+     *
+     * @param c a callable
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable>
+    std::enable_if_t<trait::is_callable_v<ext_arg_list, Callable>, connection>
+    connect_extended(Callable && c, group_id gid = 0) {
+        using slot_t = detail::slot_extended<Callable, T...>;
+        return connect_slot_extended<slot_t>(std::forward<Callable>(c), gid);
+    }
+
+    /**
+     * Overload of connect for pointers over member functions derived from
+     * observer.
+     *
+     * @param pmf a pointer over member function
+     * @param ptr an object pointer derived from observer
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Pmf, typename Ptr>
+    std::enable_if_t<trait::is_callable_v<arg_list, Pmf, Ptr> &&
+                     trait::is_observer_v<Ptr>, connection>
+    connect(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
+        using slot_t = detail::slot_pmf<Pmf, Ptr, T...>;
+        auto conn = connect_slot<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr), gid);
+        if (conn.valid()) {
+            ptr->add_connection(conn);
+        }
+        return conn;
+    }
+
+    /**
+     * Overload of connect for pointers over member functions.
+     *
+     * @param pmf a pointer over member function
+     * @param ptr an object pointer
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Pmf, typename Ptr>
+    std::enable_if_t<trait::is_callable_v<arg_list, Pmf, Ptr> &&
+                     !trait::is_observer_v<Ptr> &&
+                     !trait::is_trackable_v<Ptr> &&
+                     !trait::is_weak_ptr_compatible_v<Ptr>, connection>
+    connect(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
+        using slot_t = detail::slot_pmf<Pmf, Ptr, T...>;
+        return connect_slot<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr), gid);
+    }
+
+    /**
+     * Overload of connect for pointers over member functions of objects
+     * derived from trackable.
+     *
+     * The slot is disconnected when the object is destroyed, and emission
+     * checks that it is alive without touching any reference count.
+     *
+     * @param pmf a pointer over member function
+     * @param ptr an object pointer derived from trackable
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Pmf, typename Ptr>
+    std::enable_if_t<trait::is_callable_v<arg_list, Pmf, Ptr> &&
+                     trait::is_trackable_v<Ptr>, connection>
+    connect(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
+        using slot_t = detail::slot_pmf_trackable<Pmf, Ptr, T...>;
+        const trackable *t = ptr;
+        auto conn = connect_slot<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr),
+                                         *t->m_state, gid);
+        if (conn.valid()) {
+            t->add_connection(conn);
+        }
+        return conn;
+    }
+
+    /**
+     * Overload of connect for a callable whose lifetime is tied to an object
+     * derived from trackable.
+     *
+     * The slot is disconnected when the object is destroyed, and emission
+     * checks that it is alive without touching any reference count.
+     *
+     * @param c a callable
+     * @param ptr an object pointer derived from trackable
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable, typename Ptr>
+    std::enable_if_t<trait::is_callable_v<arg_list, Callable> &&
+                     trait::is_trackable_v<Ptr>, connection>
+    connect(Callable && c, Ptr && ptr, group_id gid = 0) {
+        using slot_t = detail::slot_trackable<Callable, Ptr, T...>;
+        const trackable *t = ptr;
+        auto conn = connect_slot<slot_t>(std::forward<Callable>(c), std::forward<Ptr>(ptr),
+                                         *t->m_state, gid);
+        if (conn.valid()) {
+            t->add_connection(conn);
+        }
+        return conn;
+    }
+
+    /**
+     * Overload of connect for pointer over member functions and additional
+     * connection argument.
+     *
+     * The callable's first argument must be of type connection. The callable
+     * can manage its own connection through this argument.
+     *
+     * @param pmf a pointer over member function
+     * @param ptr an object pointer
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Pmf, typename Ptr>
+    std::enable_if_t<trait::is_callable_v<ext_arg_list, Pmf, Ptr> &&
+                     !trait::is_weak_ptr_compatible_v<Ptr>, connection>
+    connect_extended(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
+        using slot_t = detail::slot_pmf_extended<Pmf, Ptr, T...>;
+        return connect_slot_extended<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr), gid);
+    }
+
+    /**
+     * Overload of connect for lifetime object tracking and automatic disconnection.
+     *
+     * Ptr must be convertible to an object following a loose form of weak pointer
+     * concept, by implementing the ADL-detected conversion function to_weak().
+     *
+     * This overload covers the case of a pointer over member function and a
+     * trackable pointer of that class.
+     *
+     * Note: only weak references are stored, a slot does not extend the lifetime
+     * of a supplied object.
+     *
+     * @param pmf a pointer over member function
+     * @param ptr a trackable object pointer
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Pmf, typename Ptr>
+    std::enable_if_t<!trait::is_callable_v<arg_list, Pmf> &&
+                     trait::is_weak_ptr_compatible_v<Ptr>, connection>
+    connect(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
+        using trait::to_weak;
+        auto w = to_weak(std::forward<Ptr>(ptr));
+        using slot_t = detail::slot_pmf_tracked<Pmf, decltype(w), T...>;
+        return connect_slot<slot_t>(std::forward<Pmf>(pmf), w, gid);
+    }
+
+    /**
+     * Overload of connect for lifetime object tracking and automatic disconnection
+     * with additional connection management.
+     *
+     * The callable's first argument must be of type connection. The callable
+     * can manage its own connection through this argument.
+     *
+     * Ptr must be convertible to an object following a loose form of weak pointer
+     * concept, by implementing the ADL-detected conversion function to_weak().
+     *
+     * This overload covers the case of a pointer over member function and a
+     * trackable pointer of that class.
+     *
+     * Note: only weak references are stored, a slot does not extend the lifetime
+     * of a supplied object.
      *
-     * @param a... arguments to emit
+     * @param pmf a pointer over member function
+     * @param ptr a trackable object pointer
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Pmf, typename Ptr>
+    std::enable_if_t<!trait::is_callable_v<ext_arg_list, Pmf> &&
+                     trait::is_weak_ptr_compatible_v<Ptr>, connection>
+    connect_extended(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
+        using trait::to_weak;
+        auto w = to_weak(std::forward<Ptr>(ptr));
+        using slot_t = detail::slot_pmf_tracked_extended<Pmf, decltype(w), T...>;
+        return connect_slot_extended<slot_t>(std::forward<Pmf>(pmf), w, gid);
+    }
+
+    /**
+     * Overload of connect for lifetime object tracking and automatic disconnection.
+     *
+     * Trackable must be convertible to an object following a loose form of weak
+     * pointer concept, by implementing the ADL-detected conversion function to_weak().
+     *
+     * This overload covers the case of a standalone callable and unrelated trackable
+     * object.
+     *
+     * Note: only weak references are stored, a slot does not extend the lifetime
+     * of a supplied object.
+     *
+     * @param c a callable
+     * @param ptr a trackable object pointer
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable, typename Trackable>
+    std::enable_if_t<trait::is_callable_v<arg_list, Callable> &&
+                     trait::is_weak_ptr_compatible_v<Trackable>, connection>
+    connect(Callable && c, Trackable && ptr, group_id gid = 0) {
+        using trait::to_weak;
+        auto w = to_weak(std::forward<Trackable>(ptr));
+        using slot_t = detail::slot_tracked<Callable, decltype(w), T...>;
+        return connect_slot<slot_t>(std::forward<Callable>(c), w, gid);
+    }
+
+    /**
+     * Overload of connect for lifetime object tracking and automatic disconnection
+     * with additional connection management.
+     *
+     * The callable's first argument must be of type connection. The callable
+     * can manage its own connection through this argument.
+     *
+     * Trackable must be convertible to an object following a loose form of weak
+     * pointer concept, by implementing the ADL-detected conversion function to_weak().
+     *
+     * This overload covers the case of a standalone callable and unrelated trackable
+     * object.
+     *
+     * Note: only weak references are stored, a slot does not extend the lifetime
+     * of a suppied object.
+     *
+     * @param c a callable
+     * @param ptr a trackable object pointer
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable, typename Trackable>
+    std::enable_if_t<trait::is_callable_v<ext_arg_list, Callable> &&
+                     trait::is_weak_ptr_compatible_v<Trackable>, connection>
+    connect_extended(Callable && c, Trackable && ptr, group_id gid = 0) {
+        using trait::to_weak;
+        auto w = to_weak(std::forward<Trackable>(ptr));
+        using slot_t = detail::slot_tracked_extended<Callable, decltype(w), T...>;
+        return connect_slot_extended<slot_t>(std::forward<Callable>(c), w, gid);
+    }
+
+    /**
+     * Connect a callable of compatible arguments, whose calls are queued.
+     *
+     * Effect: Creates and stores a new slot which, on every subsequent signal
+     *         emission, posts a call of the supplied callable to an event
+     *         queue, along with a copy of the arguments. The call is run when
+     *         the owner of the queue processes it, unless the slot has been
+     *         disconnected or blocked in the meantime.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @param q an event queue, that must outlive the connection
+     * @param c a callable
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable>
+    std::enable_if_t<trait::is_callable_v<arg_list, Callable>, connection>
+    connect_queued(event_queue &q, Callable && c, group_id gid = 0) {
+        using slot_t = detail::slot_queued<Callable, T...>;
+        return connect_slot<slot_t>(std::forward<Callable>(c), q, gid);
+    }
+
+    /**
+     * Overload of connect_queued for lifetime object tracking and automatic
+     * disconnection.
+     *
+     * The tracked object is checked both when posting a call and when running
+     * it, and is kept alive while the call runs.
+     *
+     * @param q an event queue, that must outlive the connection
+     * @param c a callable
+     * @param ptr a trackable object pointer
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable, typename Trackable>
+    std::enable_if_t<trait::is_callable_v<arg_list, Callable> &&
+                     trait::is_weak_ptr_compatible_v<Trackable>, connection>
+    connect_queued(event_queue &q, Callable && c, Trackable && ptr, group_id gid = 0) {
+        using trait::to_weak;
+        auto w = to_weak(std::forward<Trackable>(ptr));
+        using slot_t = detail::slot_queued_tracked<Callable, decltype(w), T...>;
+        return connect_slot<slot_t>(std::forward<Callable>(c), w, q, gid);
+    }
+
+    /**
+     * Chain another signal with the same argument types to this one, fusing
+     * its slots into the emission of this signal
+     *
+     * Effect: Emitting this signal calls the slots of the chained signal, and
+     *         recursively those of the signals fused to it, by walking a
+     *         flattened dispatch list instead of emitting each signal in turn.
+     *         Each thread keeps the lists of the signals it emitted last and
+     *         rebuilds one whenever a signal it was built from gets modified,
+     *         blocked or unblocked.
+     * Lifetime: The lists cached by a thread hold strong references to the
+     *         slots of the downstream signals, a slot disconnected from one of
+     *         them and the state its callable captured being only destroyed
+     *         once every thread that emitted this signal emitted it again,
+     *         or exited. Modifying this signal drops the list cached by the
+     *         calling thread right away.
+     * Safety: Thread-safety depends on locking policy. The chained signal
+     *         must outlive the connection, and chains must not form cycles.
+     *
+     * @param sig the signal to chain
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the link
+     */
+    template <typename L>
+    connection connect_fused(signal_base<L, T...> &sig, group_id gid = 0) {
+        static_assert(detail::slot_capacity<Lockable>::value == 0 &&
+                      detail::slot_capacity<L>::value == 0,
+                      "inplace signals cannot be fused, their slots do not outlive them");
+        using slot_t = detail::slot_fused<signal_base<L, T...>, T...>;
+        auto conn = connect_slot<slot_t>(sig, gid);
+        m_fused.store(true, std::memory_order_relaxed);
+        return conn;
+    }
+
+#ifdef SIGSLOT_COROUTINES_ENABLED
+    /**
+     * Await the next emission of the signal, from a coroutine.
+     *
+     * Effect: co_await sig.next() suspends the coroutine until the signal
+     *         gets emitted, and resumes it on the emitting thread with a copy
+     *         of the emitted arguments. No connection object is created.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @param gid an identifier that can be used to order slot execution
+     * @return an awaitable object
+     */
+    signal_awaiter<Lockable, T...> next(group_id gid = 0) noexcept {
+        return {*this, gid};
+    }
+#endif
+
+    /**
+     * Creates a connection whose duration is tied to the return object.
+     * Uses the same semantics as connect
+     */
+    template <typename... CallArgs>
+    scoped_connection connect_scoped(CallArgs && ...args) {
+        return connect(std::forward<CallArgs>(args)...);
+    }
+
+    /**
+     * Disconnect slots bound to a callable
+     *
+     * Effect: Disconnects all the slots bound to the callable in argument.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * If the callable is a free or static member function, this overload is always
+     * available. However, RTTI is needed for it to work for pointer to member
+     * functions, function objects or and (references to) lambdas, because the
+     * C++ spec does not mandate the pointers to member functions to be unique.
+     *
+     * @param c a callable
+     * @return the number of disconnected slots
+     */
+    template <typename Callable>
+    std::enable_if_t<(trait::is_callable_v<arg_list, Callable> ||
+                      trait::is_callable_v<ext_arg_list, Callable> ||
+                      trait::is_pmf_v<Callable>) &&
+                     detail::function_traits<Callable>::is_disconnectable, size_t>
+    disconnect(const Callable &c) {
+        const auto key = detail::get_function_ptr(c).hash();
+        return disconnect_lookup(key != 0, [&] (const index_type &idx, auto &&fn) {
+            idx.for_callable(key, fn);
+        }, [&] (const auto &s) {
+            return s->has_full_callable(c);
+        });
+    }
+
+    /**
+     * Disconnect slots bound to this object
+     *
+     * Effect: Disconnects all the slots bound to the object or tracked object
+     *         in argument.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * The object may be a pointer or trackable object.
+     *
+     * @param obj an object
+     * @return the number of disconnected slots
+     */
+    template <typename Obj>
+    std::enable_if_t<!trait::is_callable_v<arg_list, Obj> &&
+                     !trait::is_callable_v<ext_arg_list, Obj> &&
+                     !trait::is_pmf_v<Obj>, size_t>
+    disconnect(const Obj &obj) {
+        const auto key = detail::get_object_ptr(obj);
+        return disconnect_lookup(key != nullptr, [&] (const index_type &idx, auto &&fn) {
+            idx.for_object(key, fn);
+        }, [&] (const auto &s) {
+            return s->has_object(obj);
+        });
+    }
+
+    /**
+     * Disconnect slots bound both to a callable and object
+     *
+     * Effect: Disconnects all the slots bound to the callable and object in argument.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * For naked pointers, the Callable is expected to be a pointer over member
+     * function. If obj is trackable, any kind of Callable can be used.
+     *
+     * @param c a callable
+     * @param obj an object
+     * @return the number of disconnected slots
+     */
+    template <typename Callable, typename Obj>
+    size_t disconnect(const Callable &c, const Obj &obj) {
+        const auto key = detail::get_object_ptr(obj);
+        return disconnect_lookup(key != nullptr, [&] (const index_type &idx, auto &&fn) {
+            idx.for_object(key, fn);
+        }, [&] (const auto &s) {
+            return s->has_object(obj) && s->has_callable(c);
+        });
+    }
+
+    /**
+     * Disconnect slots in a particular group
+     *
+     * Effect: Disconnects all the slots in the group id in argument.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @param gid a group id
+     * @return the number of disconnected slots
+     */
+    size_t disconnect(group_id gid) {
+        lock_type lock(m_mutex);
+        const size_t count = write_slots().remove_group(gid, [&] (const auto &s) {
+            release_slot(*s);
+            unindex(*s);
+        });
+        publish();
+        return count;
+    }
+
+    /**
+     * Disconnects all the slots
+     * Safety: Thread safety depends on locking policy
+     */
+    void disconnect_all() {
+        lock_type lock(m_mutex);
+        clear();
+    }
+
+    /**
+     * Blocks signal emission
+     * Safety: thread safe
+     */
+    void block() noexcept {
+        m_block.store(true);
+        m_version.store(detail::next_fused_version(), std::memory_order_release);
+    }
+
+    /**
+     * Unblocks signal emission
+     * Safety: thread safe
+     */
+    void unblock() noexcept {
+        m_block.store(false);
+        m_version.store(detail::next_fused_version(), std::memory_order_release);
+    }
+
+    /**
+     * Sets the maximum emission depth of the signal
+     *
+     * Effect: Emissions of signals with a maximum depth are tracked by a per
+     *         thread trampoline. An emission of this signal happening while
+     *         the thread already runs max_depth nested emissions of such
+     *         signals, typically from a slot, gets deferred: the arguments are
+     *         copied and the emission runs once the outermost one is done with
+     *         its slots, in order and without recursing. The stack depth of
+     *         emission cycles is then bounded. The default depth of 0 runs
+     *         every emission right away. Only plain emission is affected.
+     *         The arguments must be copyable, and cannot be non-const lvalue
+     *         references, whose writes by deferred slots would be lost.
+     * Safety: thread safe
+     *
+     * @param max_depth the maximum depth, or 0 to disable deferred emission
+     */
+    void set_max_depth(size_t max_depth) noexcept {
+        static_assert(detail::deferrable<T...>::value,
+                      "deferred emission needs copyable arguments, and no mutable references");
+        m_max_depth.store(max_depth);
+    }
+
+    /**
+     * Gets the maximum emission depth of the signal
+     */
+    size_t max_depth() const noexcept {
+        return m_max_depth.load();
+    }
+
+    /**
+     * Enables or disables the disconnection index of the signal
+     *
+     * Effect: An indexed signal keeps its slots in hash tables by object and
+     *         by callable, which turns disconnection by object, callable, or
+     *         both into hash lookups instead of a scan of every slot. This
+     *         costs memory and makes connection and disconnection of slots a
+     *         bit slower. Enabling the index builds it from the slots already
+     *         connected.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @param indexed whether to index the slots
+     */
+    void set_indexed(bool indexed) {
+        lock_type lock(m_mutex);
+        if (!indexed) {
+            m_index.reset();
+            return;
+        }
+        if (m_index) {
+            return;
+        }
+
+        auto idx = std::make_unique<index_type>();
+        for (const auto &s : write_slots()) {
+            idx->insert(s.get());
+        }
+        m_index = std::move(idx);
+        publish();
+    }
+
+    /**
+     * Tests whether the signal keeps a disconnection index
+     */
+    bool indexed() const {
+        lock_type lock(m_mutex);
+        return m_index != nullptr;
+    }
+
+    /**
+     * Tests blocking state of signal emission
+     */
+    bool blocked() const noexcept {
+        return m_block.load();
+    }
+
+    /**
+     * Get number of connected slots
+     * Safety: thread safe
+     */
+    size_t slot_count() noexcept {
+        cow_copy_type<list_type, Lockable> ref = slots_reference();
+        const size_t size = detail::cow_read(ref).size();
+        const size_t tombstones = m_tombstones.load(std::memory_order_relaxed);
+        return size > tombstones ? size - tombstones : 0;
+    }
+
+protected:
+    /**
+     * remove disconnected slots
+     */
+    void clean(detail::slot_state *state) override {
+        lock_type lock(m_mutex);
+
+        // rather than copying the list an emission shares, leave the slot in
+        // place as a tombstone, skipped by emission and removed once the list
+        // is not shared anymore, as long as tombstones do not outnumber slots
+        // or the list cannot be copied
+        if (const auto *shared = detail::cow_shared(m_slots)) {
+            const auto count = m_tombstones.load(std::memory_order_relaxed) + 1;
+            if (2 * count <= shared->size() || !copies_slots) {
+                if (shared->contains(state)) {
+                    m_tombstones.store(count, std::memory_order_relaxed);
+                }
+                return;
+            }
+        }
+
+        if (m_tombstones.load(std::memory_order_relaxed) > 0) {
+            // the slot is disconnected already, hence a tombstone as well
+            write_slots();
+        } else if (detail::cow_write(m_slots).remove(state)) {
+            unindex(*state);
+        }
+        publish();
+    }
+
+    /**
+     * remove all the slots detached by the caller in one go
      */
+    void clean_detached(const detail::slot_handle *first,
+                        const detail::slot_handle *last) override {
+        lock_type lock(m_mutex);
+
+        // detached slots are tombstones too, which can be counted instead of
+        // being removed from a copy of a shared list. The slots disconnected
+        // by other means are counted by their own call to clean().
+        if (const auto *shared = detail::cow_shared(m_slots)) {
+            const auto count = m_tombstones.load(std::memory_order_relaxed) +
+                static_cast<size_t>(std::count_if(first, last, [&] (const auto &s) {
+                    return shared->contains(s.get());
+                }));
+            if (2 * count <= shared->size() || !copies_slots) {
+                m_tombstones.store(count, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        remove_tombstones(detail::cow_write(m_slots));
+        publish();
+    }
+
+private:
+    // whether a list shared by an emission can be copied to be modified
+    static constexpr bool copies_slots =
+        detail::cow_copies<cow_type<list_type, Lockable>>::value;
+
+    // to be called under lock: the slots for writing, rid of the tombstones
+    list_type & write_slots() const {
+        auto &slots = detail::cow_write(m_slots);
+        if (m_tombstones.load(std::memory_order_relaxed) > 0) {
+            remove_tombstones(slots);
+        }
+        return slots;
+    }
+
+    // to be called under lock: remove the disconnected slots from the list
+    void remove_tombstones(list_type &slots) const {
+        slots.remove_if([this] (const auto &s) {
+            if (s->connected_flag_set()) {
+                return false;
+            }
+            unindex(*s);
+            return true;
+        });
+        m_tombstones.store(0, std::memory_order_relaxed);
+    }
+
+    // remove the tombstones, unless the list is still shared by an emission
+    void sweep() const {
+        lock_type lock(m_mutex);
+        if (m_tombstones.load(std::memory_order_relaxed) > 0 && !detail::cow_shared(m_slots)) {
+            write_slots();
+            publish();
+        }
+    }
+
+    // used to get a reference to the slots for reading
+    inline cow_copy_type<list_type, Lockable> slots_reference() const {
+        return detail::cow_snapshot(m_slots, m_mutex);
+    }
+
+    // mark a slot removed from the list as disconnected, for the sake of
+    // snapshots that may outlive its removal
+    static void release_slot(detail::slot_state &s) noexcept {
+        s.m_flags.fetch_and(~detail::slot_state::connected_flag, std::memory_order_acq_rel);
+    }
+
+    // create a new slot, small enough slots are stored in the slot pool, and
+    // over-aligned ones come from the global allocator
+    // a null pointer is returned if the signal has no room left for it
+    template <typename Slot, typename... A>
+    inline slot_ptr make_slot(A && ...a) {
+        constexpr bool aligned = alignof(Slot) > detail::slot_pool_base::block_align;
+        static_assert(detail::slot_capacity<Lockable>::value == 0 || !aligned,
+                      "over-aligned callables cannot be stored in an inplace signal");
+        static_assert(detail::slot_capacity<Lockable>::value == 0 ||
+                      detail::slot_state::allocation_size(sizeof(Slot)) <= detail::slot_pool_base::block_size,
+                      "callable too large to be stored in an inplace signal");
+        auto *pool = aligned ? detail::aligned_slot_pool<alignof(Slot)>::instance()
+                             : m_pool.acquire(m_resource);
+        if (!pool) {
+            return slot_ptr{};
+        }
+        return slot_ptr{new (pool) Slot(*this, std::forward<A>(a)...)};
+    }
+
+    // create a slot and add it to the list, the connection is invalid if the
+    // slot could not be created
+    template <typename Slot, typename... A>
+    connection connect_slot(A && ...a) {
+        auto s = make_slot<Slot>(std::forward<A>(a)...);
+        if (!s) {
+            return connection();
+        }
+        connection conn(detail::slot_handle{s.get()});
+        add_slot(std::move(s));
+        return conn;
+    }
+
+    // same for extended slots, which are handed their own connection
+    template <typename Slot, typename... A>
+    connection connect_slot_extended(A && ...a) {
+        auto s = make_slot<Slot>(std::forward<A>(a)...);
+        if (!s) {
+            return connection();
+        }
+        connection conn(detail::slot_handle{s.get()});
+        static_cast<Slot &>(*s).conn.value = conn;
+        add_slot(std::move(s));
+        return conn;
+    }
+
+    // same for awaiting slots, which are only referred to by their awaiter,
+    // throws if the slot could not be created
+    template <typename Slot, typename A>
+    void connect_slot_awaiting(A &a, group_id gid, detail::slot_handle &h) {
+        auto s = make_slot<Slot>(a, gid);
+        if (!s) {
+            throw std::bad_alloc();
+        }
+        h = detail::slot_handle{s.get()};
+        add_slot(std::move(s));
+    }
+
+    // add the slot to the list of slots of the right group
+    void add_slot(slot_ptr &&s) {
+        lock_type lock(m_mutex);
+        auto &list = write_slots();
+        index_slots(&s, &s + 1, [&] {
+            list.add(std::move(s));
+        });
+        publish();
+    }
+
+    // to be called under lock: index slots, then add them to the list
+    template <typename It, typename Add>
+    void index_slots(It first, It last, Add && add) {
+        if (!m_index) {
+            add();
+            return;
+        }
+
+        try {
+            for (auto it = first; it != last; ++it) {
+                m_index->insert(it->get());
+            }
+            add();
+        } catch (...) {
+            for (auto it = first; it != last; ++it) {
+                if (*it) {
+                    m_index->erase(it->get());
+                }
+            }
+            throw;
+        }
+    }
+
+    // to be called under lock: remove a slot leaving the list from the index
+    void unindex(const detail::slot_state &s) const noexcept {
+        if (m_index) {
+            m_index->erase(&s);
+        }
+    }
+
+    // disconnect a slot if a condition occurs
+    template <typename Cond>
+    size_t disconnect_if(Cond && cond) {
+        lock_type lock(m_mutex);
+        const size_t count = write_slots().remove_if([&] (const auto &s) {
+            if (cond(s)) {
+                release_slot(*s);
+                unindex(*s);
+                return true;
+            }
+            return false;
+        });
+
+        publish();
+        return count;
+    }
+
+    // disconnect the slots matching a condition, only checking those that the
+    // lookup function finds in the index, if the signal is indexed and there
+    // is a key to look up
+    template <typename Lookup, typename Cond>
+    size_t disconnect_lookup(bool keyed, Lookup && lookup, Cond && cond) {
+        lock_type lock(m_mutex);
+        if (!m_index || !keyed) {
+            lock.unlock();
+            return disconnect_if(std::forward<Cond>(cond));
+        }
+
+        // strong references, tombstones being swept by write_slots()
+        std::vector<slot_ptr> found;
+        lookup(*m_index, [&] (slot_base *s) {
+            if (s->connected_flag_set() && cond(s)) {
+                s->retain();
+                found.emplace_back(s);
+            }
+        });
+        if (found.empty()) {
+            return 0;
+        }
+
+        // each slot knows its position, which spares a scan of the list
+        auto &slots = write_slots();
+        for (const auto &s : found) {
+            release_slot(*s);
+            unindex(*s);
+            slots.remove(s.get());
+        }
+
+        publish();
+        return found.size();
+    }
+
+    // emission of the slots, right away
     template <typename... U>
-    void operator()(U && ...a) const {
+    void emit_now(U && ...a) const {
+        if (m_fused.load(std::memory_order_relaxed)) {
+            emit_fused(a...);
+            return;
+        }
+
+        bool shared = false;
+        {
+            // Reference to the slots to execute them out of the lock
+            // a copy may occur if another thread writes to it.
+            cow_copy_type<list_type, Lockable> ref = slots_reference();
+
+            detail::cow_emission<cow_copy_type<list_type, Lockable>> emission(ref);
+            for (const auto &s : detail::cow_read(ref)) {
+                s->operator()(a...);
+            }
+
+            // a slot may have destroyed the signal, which only keeps sharing
+            // the list with the reference if it is still alive, provided that
+            // no other emission, possibly a nested one, holds a reference too
+            shared = emission.leave() && detail::cow_shared(ref) != nullptr;
+        }
+
+        // the slots disconnected during emission may be swept now
+        if (shared && m_tombstones.load(std::memory_order_relaxed) > 0) {
+            sweep();
+        }
+    }
+
+    // plain emission, through the trampoline if the signal has a maximum depth
+    template <typename... U>
+    void emit_plain(std::true_type, U && ...a) const {
+        if (m_max_depth.load(std::memory_order_relaxed) > 0) {
+            emit_trampolined(a...);
+            return;
+        }
+
+        emit_now(a...);
+    }
+
+    // signals whose emissions cannot be deferred never get a maximum depth
+    template <typename... U>
+    void emit_plain(std::false_type, U && ...a) const {
+        emit_now(a...);
+    }
+
+    // emission through the trampoline of the calling thread, deferred if the
+    // thread is too deep into nested emissions already. The outermost emission
+    // runs the deferred ones, or drops them if a slot throws.
+    template <typename... U>
+    void emit_trampolined(U && ...a) const {
+        auto &t = detail::trampoline::local();
+        if (t.depth >= m_max_depth.load(std::memory_order_relaxed)) {
+            using call_type = detail::deferred_emission<signal_base, std::decay_t<T>...>;
+            t.push(new call_type(this, a...));
+            return;
+        }
+
+        if (t.depth > 0 || t.draining) {
+            detail::trampoline::level l(t);
+            emit_now(a...);
+            return;
+        }
+
+        try {
+            {
+                detail::trampoline::level l(t);
+                emit_now(a...);
+            }
+            t.drain();
+        } catch (...) {
+            t.draining = false;
+            t.drop();
+            throw;
+        }
+    }
+
+    // to be called under lock: publish a modification of the slots, which
+    // also invalidates the flattened dispatch lists built from them
+    void publish() const {
+        detail::cow_publish(m_slots);
+        m_version.store(detail::next_fused_version(), std::memory_order_release);
+        if (m_fused.load(std::memory_order_relaxed)) {
+            release_fused();
+        }
+    }
+
+    // drop the flattened list cached by the calling thread, if any, so that a
+    // thread modifying the signals it emits does not delay slot destruction
+    void release_fused() const noexcept {
+        auto *e = detail::fused_cache<T...>::get(this);
+        if (e && e->owner == this && e->pins == 0) {
+            e->owner = nullptr;
+            e->list.clear();
+        }
+    }
+
+    // append the slots to a flattened dispatch list, followed for each fused
+    // link by the slots of the signal it is chained to. The version is read
+    // first, so that a concurrent modification leaves the list stale.
+    void flatten_into(detail::fused_list<T...> &l) const {
+        l.deps.push_back({&m_version, m_version.load(std::memory_order_acquire)});
         if (m_block) {
             return;
         }
 
-        // Reference to the slots to execute them out of the lock
-        // a copy may occur if another thread writes to it.
-        cow_copy_type<list_type, Lockable> ref = slots_reference();
+        cow_copy_type<list_type, Lockable> ref = slots_reference();
+        for (const auto &s : detail::cow_read(ref)) {
+            const auto i = l.entries.size();
+            l.entries.push_back({s, 0});
+            if (s->fuse(l)) {
+                l.entries[i].end = l.entries.size();
+            }
+        }
+    }
+
+    // emission through a flattened dispatch list, borrowed from the calling
+    // thread cache and rebuilt first if one of its signals changed
+    template <typename... U>
+    void emit_fused(U && ...a) const {
+        using cache = detail::fused_cache<T...>;
+        auto *e = cache::get(this);
+        if (e && !(e->owner == this && e->list.valid())) {
+            // an outer emission may still be iterating over this entry
+            if (e->pins > 0) {
+                e = nullptr;
+            } else {
+                e->owner = nullptr;
+                e->list.clear();
+                flatten_into(e->list);
+                e->owner = this;
+            }
+        }
+
+        detail::fused_list<T...> own;
+        if (!e) {
+            flatten_into(own);
+        }
+
+        detail::pin_guard<typename cache::entry> pin(e);
+        const auto &entries = e ? e->list.entries : own.entries;
+        for (std::size_t i = 0, n = entries.size(); i < n; ++i) {
+            const auto &x = entries[i];
+            if (x.end == 0) {
+                x.slot->operator()(a...);
+            } else if (!x.slot->callable()) {
+                // blocked link, skip the slots fused behind it
+                i = x.end - 1;
+            }
+        }
+    }
+
+    // to be called under lock: remove all the slots
+    void clear() {
+        auto &slots = detail::cow_write(m_slots);
+        for (const auto &s : slots) {
+            release_slot(*s);
+        }
+        slots.clear();
+        m_tombstones.store(0, std::memory_order_relaxed);
+        if (m_index) {
+            m_index->clear();
+        }
+        publish();
+    }
+
+private:
+    mutable Lockable m_mutex;
+    mutable cow_type<list_type, Lockable> m_slots;     // swept by emission
+    mutable std::atomic<size_t> m_tombstones{0};       // disconnected slots left in m_slots
+    std::atomic<bool> m_block;
+    std::atomic<bool> m_fused{false};
+    std::atomic<size_t> m_max_depth{0};
+    mutable std::atomic<std::uint64_t> m_version{detail::next_fused_version()};
+    std::unique_ptr<index_type> m_index;
+    pool_type m_pool;
+    detail::memory_resource *m_resource = nullptr;
+};
+
+
+/**
+ * Freestanding connect function that defers to the `signal_base::connect` member.
+ */
+template <typename Lockable, typename Arg, typename... T, typename ...Args>
+std::enable_if_t<!trait::is_signal_v<std::decay_t<Arg>>, connection>
+connect(signal_base<Lockable, T...> &sig, Arg &&arg, Args && ...args)
+{
+    return sig.connect(std::forward<Arg>(arg), std::forward<Args>(args)...);
+}
+
+/**
+ * Freestanding connect function that chains one signal to another.
+ */
+template <typename Lockable1, typename Lockable2, typename... T1, typename... T2, typename... Args>
+connection connect(signal_base<Lockable1, T1...> &sig1,
+                   signal_base<Lockable2, T2...> &sig2,
+                   Args && ...args)
+{
+    return sig1.connect(detail::signal_wrapper<signal_base<Lockable2, T2...>>{std::addressof(sig2)},
+                        std::forward<Args>(args)...);
+}
+
+/**
+ * Freestanding function that chains one signal to another with the same
+ * argument types, fusing the slots of the latter into the emission of the
+ * former. It defers to the `signal_base::connect_fused` member.
+ */
+template <typename Lockable1, typename Lockable2, typename... T>
+connection connect_fused(signal_base<Lockable1, T...> &sig1,
+                         signal_base<Lockable2, T...> &sig2,
+                         group_id gid = 0)
+{
+    return sig1.connect_fused(sig2, gid);
+}
+
+
+/**
+ * Specialization of signal_base to be used in single threaded contexts.
+ * Slot connection, disconnection and signal emission are not thread-safe.
+ * The performance improvement over the thread-safe variant is not impressive,
+ * so this is not very useful.
+ */
+template <typename... T>
+using signal_st = signal_base<detail::null_mutex, T...>;
+
+/**
+ * Specialization of signal_base to be used in multi-threaded contexts.
+ * Slot connection, disconnection and signal emission are thread-safe.
+ *
+ * Recursive signal emission and emission cycles are supported too.
+ */
+template <typename... T>
+using signal = signal_base<std::mutex, T...>;
+
+/**
+ * Specialization of signal_base to be used in multi-threaded contexts, whose
+ * emission never locks.
+ * Emitting threads read the slot list through an atomic pointer while pinned
+ * to an epoch, and modifications publish a new list, the former one being
+ * reclaimed once no thread may still be reading it. This favors heavily
+ * emitted signals at the expense of connection and disconnection, which copy
+ * the slot list every time.
+ */
+template <typename... T>
+using signal_rcu = signal_base<detail::epoch_lock<std::mutex>, T...>;
+
+/**
+ * Specialization of signal_base to be used in multi-threaded contexts, for
+ * signals whose slots seldom change.
+ * Every emitting thread caches a reference to the slot list, which it reuses
+ * without locking as long as a generation number, bumped by every connection
+ * and disconnection, is unchanged. Disconnected slots are only destroyed once
+ * every thread that emitted the signal refreshed its cache.
+ */
+template <typename... T>
+using signal_cached = signal_base<detail::cached_lock<std::mutex>, T...>;
+
+/**
+ * Specialization of signal_base to be used in multi-threaded contexts, that
+ * never allocates memory once constructed.
+ * Up to N slots are stored in blocks allocated once by the constructor, from
+ * the memory resource of the signal or the heap by default, connecting more
+ * returns an invalid connection. Callables must be small
+ * enough to fit in a slot pool block along with the slot state. The signal
+ * cannot be moved. Connection objects may outlive it, but the block of a
+ * disconnected slot is only reclaimed once no connection object, including
+ * those held by observers and trackable objects, refers to it anymore,
+ * connecting meanwhile returning an invalid connection if no block is left.
+ * Emission copies the slot list on the stack, which favors small capacities.
+ */
+template <std::size_t N, typename... T>
+using inplace_signal = signal_base<detail::inplace_lock<std::mutex, N>, T...>;
+
+
+/**
+ * Combiners aggregate the values returned by the slots of a signal_r during
+ * an emission. A fresh copy of the combiner of the signal is used for every
+ * emission, which feeds it the slot results in calling order through push()
+ * and then returns result(). push() returns false to skip the remaining slots.
+ */
+namespace combiner {
+
+/// keeps the value returned by the last slot called, or R{} without slots
+template <typename R>
+struct last {
+    using result_type = R;
+
+    bool push(R v) {
+        m_value = std::move(v);
+        return true;
+    }
+
+    result_type result() {
+        return std::move(m_value);
+    }
+
+private:
+    R m_value{};
+};
+
+/// adds the values returned by the slots to an initial value
+template <typename R>
+struct sum {
+    using result_type = R;
+
+    explicit sum(R init = R{}) : m_value(std::move(init)) {}
+
+    bool push(R v) {
+        m_value += std::move(v);
+        return true;
+    }
+
+    result_type result() {
+        return std::move(m_value);
+    }
+
+private:
+    R m_value;
+};
+
+/// keeps the smallest value returned by the slots, or init without slots
+template <typename R, typename Compare = std::less<R>>
+struct min {
+    using result_type = R;
+
+    explicit min(R init = R{}, Compare cmp = Compare{})
+        : m_value(std::move(init))
+        , m_cmp(std::move(cmp))
+    {}
+
+    bool push(R v) {
+        if (m_first || m_cmp(v, m_value)) {
+            m_value = std::move(v);
+            m_first = false;
+        }
+        return true;
+    }
+
+    result_type result() {
+        return std::move(m_value);
+    }
 
-        for (const auto &group : detail::cow_read(ref)) {
-            for (const auto &s : group.slts) {
-                s->operator()(a...);
-            }
+private:
+    R m_value;
+    Compare m_cmp;
+    bool m_first = true;
+};
+
+/// keeps the largest value returned by the slots, or init without slots
+template <typename R, typename Compare = std::less<R>>
+struct max {
+    using result_type = R;
+
+    explicit max(R init = R{}, Compare cmp = Compare{})
+        : m_value(std::move(init))
+        , m_cmp(std::move(cmp))
+    {}
+
+    bool push(R v) {
+        if (m_first || m_cmp(m_value, v)) {
+            m_value = std::move(v);
+            m_first = false;
         }
+        return true;
     }
 
-    /**
-     * Connect a callable of compatible arguments.
-     *
-     * Effect: Creates and stores a new slot responsible for executing the
-     *         supplied callable for every subsequent signal emission.
-     * Safety: Thread-safety depends on locking policy.
-     *
-     * @param c a callable
-     * @param gid an identifier that can be used to order slot execution
-     * @return a connection object that can be used to interact with the slot
-     */
-    template <typename Callable>
-    std::enable_if_t<trait::is_callable_v<arg_list, Callable>, connection>
-    connect(Callable && c, group_id gid = 0) {
-        using slot_t = detail::slot<Callable, T...>;
-        auto s = make_slot<slot_t>(std::forward<Callable>(c), gid);
-        connection conn(s);
-        add_slot(std::move(s));
-        return conn;
+    result_type result() {
+        return std::move(m_value);
     }
 
-    /**
-     * Connect a callable with an additional connection argument.
-     *
-     * The callable's first argument must be of type connection. The callable
-     * can manage its own connection through this argument.
-     *
-     * @param c a callable
-     * @param gid an identifier that can be used to order slot execution
-     * @return a connection object that can be used to interact with the slot
-     */
-    template <typename Callable>
-    std::enable_if_t<trait::is_callable_v<ext_arg_list, Callable>, connection>
-    connect_extended(Callable && c, group_id gid = 0) {
-        using slot_t = detail::slot_extended<Callable, T...>;
-        auto s = make_slot<slot_t>(std::forward<Callable>(c), gid);
-        connection conn(s);
-        std::static_pointer_cast<slot_t>(s)->conn = conn;
-        add_slot(std::move(s));
-        return conn;
+private:
+    R m_value;
+    Compare m_cmp;
+    bool m_first = true;
+};
+
+/// true if every slot returned true, stops at the first false
+struct all_of {
+    using result_type = bool;
+
+    bool push(bool v) noexcept {
+        m_value = v;
+        return v;
     }
 
-    /**
-     * Overload of connect for pointers over member functions derived from
-     * observer.
-     *
-     * @param pmf a pointer over member function
-     * @param ptr an object pointer derived from observer
-     * @param gid an identifier that can be used to order slot execution
-     * @return a connection object that can be used to interact with the slot
-     */
-    template <typename Pmf, typename Ptr>
-    std::enable_if_t<trait::is_callable_v<arg_list, Pmf, Ptr> &&
-                     trait::is_observer_v<Ptr>, connection>
-    connect(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
-        using slot_t = detail::slot_pmf<Pmf, Ptr, T...>;
-        auto s = make_slot<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr), gid);
-        connection conn(s);
-        add_slot(std::move(s));
-        ptr->add_connection(conn);
-        return conn;
+    result_type result() const noexcept {
+        return m_value;
     }
 
-    /**
-     * Overload of connect for pointers over member functions.
-     *
-     * @param pmf a pointer over member function
-     * @param ptr an object pointer
-     * @param gid an identifier that can be used to order slot execution
-     * @return a connection object that can be used to interact with the slot
-     */
-    template <typename Pmf, typename Ptr>
-    std::enable_if_t<trait::is_callable_v<arg_list, Pmf, Ptr> &&
-                     !trait::is_observer_v<Ptr> &&
-                     !trait::is_weak_ptr_compatible_v<Ptr>, connection>
-    connect(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
-        using slot_t = detail::slot_pmf<Pmf, Ptr, T...>;
-        auto s = make_slot<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr), gid);
-        connection conn(s);
-        add_slot(std::move(s));
-        return conn;
+private:
+    bool m_value = true;
+};
+
+/// true if any slot returned true, stops at the first true
+struct any_of {
+    using result_type = bool;
+
+    bool push(bool v) noexcept {
+        m_value = v;
+        return !v;
     }
 
-    /**
-     * Overload of connect for pointer over member functions and additional
-     * connection argument.
-     *
-     * The callable's first argument must be of type connection. The callable
-     * can manage its own connection through this argument.
-     *
-     * @param pmf a pointer over member function
-     * @param ptr an object pointer
-     * @param gid an identifier that can be used to order slot execution
-     * @return a connection object that can be used to interact with the slot
-     */
-    template <typename Pmf, typename Ptr>
-    std::enable_if_t<trait::is_callable_v<ext_arg_list, Pmf, Ptr> &&
-                     !trait::is_weak_ptr_compatible_v<Ptr>, connection>
-    connect_extended(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
-        using slot_t = detail::slot_pmf_extended<Pmf, Ptr, T...>;
-        auto s = make_slot<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr), gid);
-        connection conn(s);
-        std::static_pointer_cast<slot_t>(s)->conn = conn;
-        add_slot(std::move(s));
-        return conn;
+    result_type result() const noexcept {
+        return m_value;
     }
 
-    /**
-     * Overload of connect for lifetime object tracking and automatic disconnection.
-     *
-     * Ptr must be convertible to an object following a loose form of weak pointer
-     * concept, by implementing the ADL-detected conversion function to_weak().
-     *
-     * This overload covers the case of a pointer over member function and a
-     * trackable pointer of that class.
-     *
-     * Note: only weak references are stored, a slot does not extend the lifetime
-     * of a supplied object.
-     *
-     * @param pmf a pointer over member function
-     * @param ptr a trackable object pointer
-     * @param gid an identifier that can be used to order slot execution
-     * @return a connection object that can be used to interact with the slot
-     */
-    template <typename Pmf, typename Ptr>
-    std::enable_if_t<!trait::is_callable_v<arg_list, Pmf> &&
-                     trait::is_weak_ptr_compatible_v<Ptr>, connection>
-    connect(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
-        using trait::to_weak;
-        auto w = to_weak(std::forward<Ptr>(ptr));
-        using slot_t = detail::slot_pmf_tracked<Pmf, decltype(w), T...>;
-        auto s = make_slot<slot_t>(std::forward<Pmf>(pmf), w, gid);
-        connection conn(s);
-        add_slot(std::move(s));
-        return conn;
+private:
+    bool m_value = false;
+};
+
+/// collects the values returned by the slots, in calling order
+template <typename R>
+struct to_vector {
+    using result_type = std::vector<R>;
+
+    bool push(R v) {
+        m_values.push_back(std::move(v));
+        return true;
+    }
+
+    result_type result() {
+        return std::move(m_values);
+    }
+
+private:
+    std::vector<R> m_values;
+};
+
+} // namespace combiner
+
+namespace detail {
+
+// the combiner of an emission, handed to the slots of a signal_r
+template <typename Combiner>
+struct combiner_sink {
+    Combiner combiner;
+    bool done;
+};
+
+// adapts a callable returning a value to a slot feeding a combiner sink
+template <typename Combiner, typename Func>
+struct result_adapter {
+    template <typename Sink, typename... A>
+    void operator()(Sink &s, A && ...a) {
+        if (!s.done) {
+            s.done = !s.combiner.push(func(std::forward<A>(a)...));
+        }
+    }
+
+    Func func;
+};
+
+// adapts a pointer to member function and an object pointer to a callable
+template <typename Pmf, typename Ptr>
+struct pmf_adapter {
+    template <typename... A>
+    auto operator()(A && ...a) -> decltype(((*std::declval<Ptr&>()).*std::declval<Pmf&>())(std::forward<A>(a)...)) {
+        auto &obj = *ptr;
+        const auto fn = pmf;
+        return (obj.*fn)(std::forward<A>(a)...);
     }
 
+    Pmf pmf;
+    Ptr ptr;
+};
+
+} // namespace detail
+
+template <typename, typename, typename>
+class signal_r_base;
+
+/**
+ * signal_r_base is a variation of signal_base whose slots return a value of type R,
+ * which a combiner aggregates during emission into the result of the emission.
+ *
+ * The combiner is copied from the one supplied at construction for every
+ * emission, and may stop the emission early. No memory is allocated on
+ * emission unless the combiner does.
+ *
+ * Slots are connected from callables, possibly with a tracked object, or from
+ * pointers to member functions along with an object pointer. As the slots
+ * wrap those callables, disconnection goes through connection objects, group
+ * ids or disconnect_all().
+ *
+ * @tparam R the return type of the slots
+ * @tparam T... the argument types of the emitting and slots functions
+ * @tparam Combiner the combiner type, combiner::last<R> by default
+ * @tparam Lockable a lock type to decide the lock policy
+ */
+template <typename R, typename... T, typename Combiner, typename Lockable>
+class signal_r_base<R(T...), Combiner, Lockable> {
+    static_assert(!std::is_void<R>::value, "use signal_base for slots returning nothing");
+
+    using sink_type = detail::combiner_sink<Combiner>;
+    using signal_type = signal_base<Lockable, sink_type &, T...>;
+
+    template <typename F>
+    using adapter_type = detail::result_adapter<Combiner, std::decay_t<F>>;
+
+public:
+    using arg_list = trait::typelist<T...>;
+    using result_type = typename Combiner::result_type;
+
+    explicit signal_r_base(Combiner c = Combiner{})
+        : m_combiner(std::move(c))
+    {}
+
     /**
-     * Overload of connect for lifetime object tracking and automatic disconnection
-     * with additional connection management.
-     *
-     * The callable's first argument must be of type connection. The callable
-     * can manage its own connection through this argument.
-     *
-     * Ptr must be convertible to an object following a loose form of weak pointer
-     * concept, by implementing the ADL-detected conversion function to_weak().
-     *
-     * This overload covers the case of a pointer over member function and a
-     * trackable pointer of that class.
+     * Emit a signal
      *
-     * Note: only weak references are stored, a slot does not extend the lifetime
-     * of a supplied object.
+     * Effect: All non blocked and connected slot functions will be called
+     *         with supplied arguments, and their results fed to a copy of the
+     *         combiner, until it asks to stop.
+     * Safety: Same as signal_base emission.
      *
-     * @param pmf a pointer over member function
-     * @param ptr a trackable object pointer
-     * @param gid an identifier that can be used to order slot execution
-     * @return a connection object that can be used to interact with the slot
+     * @param a... arguments to emit
+     * @return the result of the combiner
      */
-    template <typename Pmf, typename Ptr>
-    std::enable_if_t<!trait::is_callable_v<ext_arg_list, Pmf> &&
-                     trait::is_weak_ptr_compatible_v<Ptr>, connection>
-    connect_extended(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
-        using trait::to_weak;
-        auto w = to_weak(std::forward<Ptr>(ptr));
-        using slot_t = detail::slot_pmf_tracked_extended<Pmf, decltype(w), T...>;
-        auto s = make_slot<slot_t>(std::forward<Pmf>(pmf), w, gid);
-        connection conn(s);
-        std::static_pointer_cast<slot_t>(s)->conn = conn;
-        add_slot(std::move(s));
-        return conn;
+    template <typename... U>
+    result_type operator()(U && ...a) const {
+        sink_type s{m_combiner, false};
+        m_signal(s, a...);
+        return s.combiner.result();
     }
 
     /**
-     * Overload of connect for lifetime object tracking and automatic disconnection.
-     *
-     * Trackable must be convertible to an object following a loose form of weak
-     * pointer concept, by implementing the ADL-detected conversion function to_weak().
-     *
-     * This overload covers the case of a standalone callable and unrelated trackable
-     * object.
-     *
-     * Note: only weak references are stored, a slot does not extend the lifetime
-     * of a supplied object.
+     * Connect a callable of compatible arguments, returning a value
+     * convertible to R.
      *
      * @param c a callable
-     * @param ptr a trackable object pointer
      * @param gid an identifier that can be used to order slot execution
      * @return a connection object that can be used to interact with the slot
      */
-    template <typename Callable, typename Trackable>
-    std::enable_if_t<trait::is_callable_v<arg_list, Callable> &&
-                     trait::is_weak_ptr_compatible_v<Trackable>, connection>
-    connect(Callable && c, Trackable && ptr, group_id gid = 0) {
-        using trait::to_weak;
-        auto w = to_weak(std::forward<Trackable>(ptr));
-        using slot_t = detail::slot_tracked<Callable, decltype(w), T...>;
-        auto s = make_slot<slot_t>(std::forward<Callable>(c), w, gid);
-        connection conn(s);
-        add_slot(std::move(s));
-        return conn;
+    template <typename Callable>
+    std::enable_if_t<trait::is_callable_r_v<R, arg_list, Callable>, connection>
+    connect(Callable && c, group_id gid = 0) {
+        return m_signal.connect(adapter_type<Callable>{std::forward<Callable>(c)}, gid);
     }
 
     /**
-     * Overload of connect for lifetime object tracking and automatic disconnection
-     * with additional connection management.
-     *
-     * The callable's first argument must be of type connection. The callable
-     * can manage its own connection through this argument.
-     *
-     * Trackable must be convertible to an object following a loose form of weak
-     * pointer concept, by implementing the ADL-detected conversion function to_weak().
-     *
-     * This overload covers the case of a standalone callable and unrelated trackable
-     * object.
-     *
-     * Note: only weak references are stored, a slot does not extend the lifetime
-     * of a suppied object.
+     * Overload of connect for lifetime object tracking and automatic
+     * disconnection.
      *
      * @param c a callable
      * @param ptr a trackable object pointer
@@ -1548,17 +6284,39 @@ public:
      * @return a connection object that can be used to interact with the slot
      */
     template <typename Callable, typename Trackable>
-    std::enable_if_t<trait::is_callable_v<ext_arg_list, Callable> &&
+    std::enable_if_t<trait::is_callable_r_v<R, arg_list, Callable> &&
                      trait::is_weak_ptr_compatible_v<Trackable>, connection>
-    connect_extended(Callable && c, Trackable && ptr, group_id gid = 0) {
+    connect(Callable && c, Trackable && ptr, group_id gid = 0) {
+        return m_signal.connect(adapter_type<Callable>{std::forward<Callable>(c)},
+                                std::forward<Trackable>(ptr), gid);
+    }
+
+    /**
+     * Overload of connect for pointers over member functions.
+     *
+     * The object is tracked if the pointer is trackable.
+     *
+     * @param pmf a pointer over member function
+     * @param ptr an object pointer
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Pmf, typename Ptr>
+    std::enable_if_t<trait::is_pmf_v<std::decay_t<Pmf>> &&
+                     !trait::is_weak_ptr_compatible_v<Ptr>, connection>
+    connect(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
+        using adapter = detail::pmf_adapter<std::decay_t<Pmf>, std::decay_t<Ptr>>;
+        return connect(adapter{std::forward<Pmf>(pmf), std::forward<Ptr>(ptr)}, gid);
+    }
+
+    template <typename Pmf, typename Ptr>
+    std::enable_if_t<trait::is_pmf_v<std::decay_t<Pmf>> &&
+                     trait::is_weak_ptr_compatible_v<Ptr>, connection>
+    connect(Pmf && pmf, Ptr && ptr, group_id gid = 0) {
         using trait::to_weak;
-        auto w = to_weak(std::forward<Trackable>(ptr));
-        using slot_t = detail::slot_tracked_extended<Callable, decltype(w), T...>;
-        auto s = make_slot<slot_t>(std::forward<Callable>(c), w, gid);
-        connection conn(s);
-        std::static_pointer_cast<slot_t>(s)->conn = conn;
-        add_slot(std::move(s));
-        return conn;
+        auto w = to_weak(ptr);
+        using adapter = detail::pmf_adapter<std::decay_t<Pmf>, decltype(w.lock().get())>;
+        return connect(adapter{std::forward<Pmf>(pmf), w.lock().get()}, w, gid);
     }
 
     /**
@@ -1570,279 +6328,221 @@ public:
         return connect(std::forward<CallArgs>(args)...);
     }
 
+    /// Disconnects all the slots in a group
+    size_t disconnect(group_id gid) {
+        return m_signal.disconnect(gid);
+    }
+
+    /// Disconnects all the slots
+    void disconnect_all() {
+        m_signal.disconnect_all();
+    }
+
+    /// Blocks signal emission, which then returns the result of an unused combiner
+    void block() noexcept {
+        m_signal.block();
+    }
+
+    /// Unblocks signal emission
+    void unblock() noexcept {
+        m_signal.unblock();
+    }
+
+    /// Tests blocking state of signal emission
+    bool blocked() const noexcept {
+        return m_signal.blocked();
+    }
+
+    /// Get number of connected slots
+    size_t slot_count() noexcept {
+        return m_signal.slot_count();
+    }
+
+private:
+    Combiner m_combiner;
+    signal_type m_signal;
+};
+
+namespace detail {
+
+template <typename Sig>
+struct default_combiner;
+
+template <typename R, typename... T>
+struct default_combiner<R(T...)> {
+    using type = combiner::last<R>;
+};
+
+} // namespace detail
+
+/**
+ * Specialization of signal_r_base to be used in single threaded contexts.
+ */
+template <typename Sig, typename Combiner = typename detail::default_combiner<Sig>::type>
+using signal_r_st = signal_r_base<Sig, Combiner, detail::null_mutex>;
+
+/**
+ * Specialization of signal_r_base to be used in multi-threaded contexts.
+ */
+template <typename Sig, typename Combiner = typename detail::default_combiner<Sig>::type>
+using signal_r = signal_r_base<Sig, Combiner, std::mutex>;
+
+
+namespace detail {
+
+constexpr bool all_of(std::initializer_list<bool> l) noexcept {
+    for (bool b : l) {
+        if (!b) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+template <typename ArgList, typename... Slots>
+class static_signal;
+
+/**
+ * static_signal is a signal whose set of slots is fixed at compile time.
+ *
+ * The slots are callables stored by value, so that emission boils down to
+ * direct calls the compiler is free to inline, without type erasure, reference
+ * counting nor locking. Slots can neither be connected nor disconnected, but
+ * they can be blocked individually, as can the whole signal.
+ *
+ * Emission is as thread-safe as the slots are, blocking is not thread-safe.
+ * Use make_static_signal() to create a static_signal.
+ *
+ * @tparam T... the argument types of the emission
+ * @tparam Slots... the types of the slots, invoked in order
+ */
+template <typename... T, typename... Slots>
+class static_signal<trait::typelist<T...>, Slots...> {
+    static_assert(detail::all_of({trait::is_callable_v<trait::typelist<T...>, Slots>...}),
+                  "the slots must be callable with the signal arguments");
+
+public:
+    using arg_list = trait::typelist<T...>;
+
+    constexpr explicit static_signal(Slots... slots)
+        : m_slots(std::move(slots)...)
+        , m_blocked{}
+        , m_block(false)
+    {}
+
     /**
-     * Disconnect slots bound to a callable
-     *
-     * Effect: Disconnects all the slots bound to the callable in argument.
-     * Safety: Thread-safety depends on locking policy.
+     * Emit a signal
      *
-     * If the callable is a free or static member function, this overload is always
-     * available. However, RTTI is needed for it to work for pointer to member
-     * functions, function objects or and (references to) lambdas, because the
-     * C++ spec does not mandate the pointers to member functions to be unique.
+     * Effect: All non blocked slots will be called with supplied arguments.
      *
-     * @param c a callable
-     * @return the number of disconnected slots
+     * @param a... arguments to emit
      */
-    template <typename Callable>
-    std::enable_if_t<(trait::is_callable_v<arg_list, Callable> ||
-                      trait::is_callable_v<ext_arg_list, Callable> ||
-                      trait::is_pmf_v<Callable>) &&
-                     detail::function_traits<Callable>::is_disconnectable, size_t>
-    disconnect(const Callable &c) {
-        return disconnect_if([&] (const auto &s) {
-            return s->has_full_callable(c);
-        });
+    template <typename... U>
+    void operator()(U && ...a) {
+        if (m_block) {
+            return;
+        }
+        emit(std::index_sequence_for<Slots...>{}, a...);
     }
 
     /**
-     * Disconnect slots bound to this object
-     *
-     * Effect: Disconnects all the slots bound to the object or tracked object
-     *         in argument.
-     * Safety: Thread-safety depends on locking policy.
-     *
-     * The object may be a pointer or trackable object.
-     *
-     * @param obj an object
-     * @return the number of disconnected slots
+     * Access the slot at index I
      */
-    template <typename Obj>
-    std::enable_if_t<!trait::is_callable_v<arg_list, Obj> &&
-                     !trait::is_callable_v<ext_arg_list, Obj> &&
-                     !trait::is_pmf_v<Obj>, size_t>
-    disconnect(const Obj &obj) {
-        return disconnect_if([&] (const auto &s) {
-            return s->has_object(obj);
-        });
+    template <std::size_t I>
+    auto & slot() noexcept {
+        return std::get<I>(m_slots);
+    }
+
+    template <std::size_t I>
+    const auto & slot() const noexcept {
+        return std::get<I>(m_slots);
     }
 
     /**
-     * Disconnect slots bound both to a callable and object
-     *
-     * Effect: Disconnects all the slots bound to the callable and object in argument.
-     * Safety: Thread-safety depends on locking policy.
-     *
-     * For naked pointers, the Callable is expected to be a pointer over member
-     * function. If obj is trackable, any kind of Callable can be used.
-     *
-     * @param c a callable
-     * @param obj an object
-     * @return the number of disconnected slots
+     * Blocks the slot at index I
      */
-    template <typename Callable, typename Obj>
-    size_t disconnect(const Callable &c, const Obj &obj) {
-        return disconnect_if([&] (const auto &s) {
-            return s->has_object(obj) && s->has_callable(c);
-        });
+    template <std::size_t I>
+    void block() noexcept {
+        std::get<I>(m_blocked) = true;
     }
 
     /**
-     * Disconnect slots in a particular group
-     *
-     * Effect: Disconnects all the slots in the group id in argument.
-     * Safety: Thread-safety depends on locking policy.
-     *
-     * @param gid a group id
-     * @return the number of disconnected slots
+     * Unblocks the slot at index I
      */
-    size_t disconnect(group_id gid) {
-        lock_type lock(m_mutex);
-        for (auto &group : detail::cow_write(m_slots)) {
-            if (group.gid == gid) {
-                size_t count = group.slts.size();
-                group.slts.clear();
-                return count;
-            }
-        }
-        return 0;
+    template <std::size_t I>
+    void unblock() noexcept {
+        std::get<I>(m_blocked) = false;
     }
 
     /**
-     * Disconnects all the slots
-     * Safety: Thread safety depends on locking policy
+     * Tests blocking state of the slot at index I
      */
-    void disconnect_all() {
-        lock_type lock(m_mutex);
-        clear();
+    template <std::size_t I>
+    bool blocked() const noexcept {
+        return std::get<I>(m_blocked);
     }
 
     /**
      * Blocks signal emission
-     * Safety: thread safe
      */
     void block() noexcept {
-        m_block.store(true);
+        m_block = true;
     }
 
     /**
      * Unblocks signal emission
-     * Safety: thread safe
      */
     void unblock() noexcept {
-        m_block.store(false);
+        m_block = false;
     }
 
     /**
      * Tests blocking state of signal emission
      */
     bool blocked() const noexcept {
-        return m_block.load();
-    }
-
-    /**
-     * Get number of connected slots
-     * Safety: thread safe
-     */
-    size_t slot_count() noexcept {
-        cow_copy_type<list_type, Lockable> ref = slots_reference();
-        size_t count = 0;
-        for (const auto &g : detail::cow_read(ref)) {
-            count += g.slts.size();
-        }
-        return count;
+        return m_block;
     }
 
-protected:
     /**
-     * remove disconnected slots
+     * Get number of slots
      */
-    void clean(detail::slot_state *state) override {
-        lock_type lock(m_mutex);
-        const auto idx = state->index();
-        const auto gid = state->group();
-
-        // find the group
-        for (auto &group : detail::cow_write(m_slots)) {
-            if (group.gid == gid) {
-                auto &slts = group.slts;
-
-                // ensure we have the right slot, in case of concurrent cleaning
-                if (idx < slts.size() && slts[idx] && slts[idx].get() == state) {
-                    std::swap(slts[idx], slts.back());
-                    slts[idx]->index() = idx;
-                    slts.pop_back();
-                }
-
-                return;
-            }
-        }
+    static constexpr std::size_t slot_count() noexcept {
+        return sizeof...(Slots);
     }
 
 private:
-    // used to get a reference to the slots for reading
-    inline cow_copy_type<list_type, Lockable> slots_reference() const {
-        lock_type lock(m_mutex);
-        return m_slots;
-    }
-
-    // create a new slot
-    template <typename Slot, typename... A>
-    inline auto make_slot(A && ...a) {
-        return detail::make_shared<slot_base, Slot>(*this, std::forward<A>(a)...);
-    }
-
-    // add the slot to the list of slots of the right group
-    void add_slot(slot_ptr &&s) {
-        const group_id gid = s->group();
-
-        lock_type lock(m_mutex);
-        auto &groups = detail::cow_write(m_slots);
-
-        // find the group
-        auto it = groups.begin();
-        while (it != groups.end() && it->gid < gid) {
-            it++;
-        }
-
-        // create a new group if necessary
-        if (it == groups.end() || it->gid != gid) {
-            it = groups.insert(it, {{}, gid});
-        }
-
-        // add the slot
-        s->index() = it->slts.size();
-        it->slts.push_back(std::move(s));
+    template <std::size_t... I, typename... U>
+    void emit(std::index_sequence<I...>, U & ...a) {
+        (void)std::initializer_list<int>{(call<I>(a...), 0)...};
     }
 
-    // disconnect a slot if a condition occurs
-    template <typename Cond>
-    size_t disconnect_if(Cond && cond) {
-        lock_type lock(m_mutex);
-        auto &groups = detail::cow_write(m_slots);
-
-        size_t count = 0;
-
-        for (auto &group : groups) {
-            auto &slts = group.slts;
-            size_t i = 0;
-            while (i < slts.size()) {
-                if (cond(slts[i])) {
-                    std::swap(slts[i], slts.back());
-                    slts[i]->index() = i;
-                    slts.pop_back();
-                    ++count;
-                } else {
-                    ++i;
-                }
-            }
+    template <std::size_t I, typename... U>
+    void call(U & ...a) {
+        if (!std::get<I>(m_blocked)) {
+            std::get<I>(m_slots)(a...);
         }
-
-        return count;
-    }
-
-    // to be called under lock: remove all the slots
-    void clear() {
-        detail::cow_write(m_slots).clear();
     }
 
 private:
-    mutable Lockable m_mutex;
-    cow_type<list_type, Lockable> m_slots;
-    std::atomic<bool> m_block;
+    std::tuple<Slots...> m_slots;
+    std::array<bool, sizeof...(Slots)> m_blocked;
+    bool m_block;
 };
 
-
-/**
- * Freestanding connect function that defers to the `signal_base::connect` member.
- */
-template <typename Lockable, typename Arg, typename... T, typename ...Args>
-std::enable_if_t<!trait::is_signal_v<std::decay_t<Arg>>, connection>
-connect(signal_base<Lockable, T...> &sig, Arg &&arg, Args && ...args)
-{
-    return sig.connect(std::forward<Arg>(arg), std::forward<Args>(args)...);
-}
-
-/**
- * Freestanding connect function that chains one signal to another.
- */
-template <typename Lockable1, typename Lockable2, typename... T1, typename... T2, typename... Args>
-connection connect(signal_base<Lockable1, T1...> &sig1,
-                   signal_base<Lockable2, T2...> &sig2,
-                   Args && ...args)
-{
-    return sig1.connect(detail::signal_wrapper<signal_base<Lockable2, T2...>>{std::addressof(sig2)},
-                        std::forward<Args>(args)...);
-}
-
-
-/**
- * Specialization of signal_base to be used in single threaded contexts.
- * Slot connection, disconnection and signal emission are not thread-safe.
- * The performance improvement over the thread-safe variant is not impressive,
- * so this is not very useful.
- */
-template <typename... T>
-using signal_st = signal_base<detail::null_mutex, T...>;
-
 /**
- * Specialization of signal_base to be used in multi-threaded contexts.
- * Slot connection, disconnection and signal emission are thread-safe.
+ * Create a static_signal emitting arguments of types T... to a fixed list of
+ * slots, which are stored by value.
  *
- * Recursive signal emission and emission cycles are supported too.
+ * @param slots... the callables to invoke, in order, upon emission
+ * @return a static_signal
  */
-template <typename... T>
-using signal = signal_base<std::mutex, T...>;
+template <typename... T, typename... Slots>
+constexpr static_signal<trait::typelist<T...>, std::decay_t<Slots>...>
+make_static_signal(Slots && ...slots) {
+    return static_signal<trait::typelist<T...>, std::decay_t<Slots>...>(std::forward<Slots>(slots)...);
+}
 
 } // namespace sigslot
 
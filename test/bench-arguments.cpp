@@ -0,0 +1,76 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static constexpr int slts = 10;
+static constexpr int emissions = 100000;
+
+// counts the copies it goes through
+struct heavy {
+    heavy() = default;
+    heavy(const heavy &o) : data(o.data) { ++copies; }
+    heavy & operator=(const heavy &o) { data = o.data; ++copies; return *this; }
+
+    std::vector<int> data = std::vector<int>(256, 1);
+    static int copies;
+};
+
+int heavy::copies = 0;
+
+static void test_copies() {
+    long sum = 0;
+    heavy h;
+
+    // slots taking a const reference see the emitted argument itself
+    sigslot::signal<heavy> sig_ref;
+    for (int s = 0; s < slts; ++s) {
+        sig_ref.connect([&] (const heavy &a) { sum += a.data[0]; });
+    }
+
+    heavy::copies = 0;
+    sig_ref(h);
+    assert(heavy::copies == 0);
+    assert(sum == slts);
+
+    // slots taking a value make their own copy, and only that one
+    sigslot::signal<heavy> sig_val;
+    for (int s = 0; s < slts; ++s) {
+        sig_val.connect([&] (heavy a) { sum += a.data[0]; });
+    }
+
+    heavy::copies = 0;
+    sig_val(h);
+    assert(heavy::copies == slts);
+    assert(sum == 2 * slts);
+}
+
+static void bench_emission() {
+    using Clock = std::chrono::high_resolution_clock;
+
+    std::size_t len = 0;
+    sigslot::signal<std::string> sig;
+    for (int s = 0; s < slts; ++s) {
+        sig.connect([&] (const std::string &a) { len += a.size(); });
+    }
+
+    const std::string arg(1024, 'a');
+    const auto begin = Clock::now();
+    for (int e = 0; e < emissions; ++e) {
+        sig(arg);
+    }
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+
+    assert(len == std::size_t(slts) * emissions * arg.size());
+    std::cout << "emission of a 1kB string to " << slts << " slots: "
+              << double(ns) / emissions << " ns" << std::endl;
+}
+
+int main() {
+    test_copies();
+    bench_emission();
+    return 0;
+}
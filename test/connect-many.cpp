@@ -0,0 +1,136 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <vector>
+
+static void test_connect_many() {
+    std::vector<int> calls;
+    std::vector<std::function<void(int)>> fns;
+    for (int i = 0; i < 100; ++i) {
+        fns.emplace_back([&calls, i] (int) { calls.push_back(i); });
+    }
+
+    sigslot::signal<int> sig;
+    auto conns = sig.connect_many(fns);
+    assert(conns.size() == 100);
+    assert(sig.slot_count() == 100);
+    assert(fns[0] != nullptr);
+
+    sig(0);
+    assert(calls.size() == 100);
+    for (int i = 0; i < 100; ++i) {
+        assert(calls[std::size_t(i)] == i);
+    }
+
+    // the connections refer to their own slot
+    for (std::size_t i = 0; i < 100; i += 2) {
+        assert(conns[i].disconnect());
+    }
+    assert(sig.slot_count() == 50);
+
+    // removal reorders the slots of a group
+    calls.clear();
+    sig(0);
+    assert(calls.size() == 50);
+    std::sort(calls.begin(), calls.end());
+    for (std::size_t i = 0; i < 50; ++i) {
+        assert(calls[i] == int(2 * i + 1));
+    }
+}
+
+// the slots of a group are called in an unspecified order, the tens digit of
+// the calls giving their group
+static bool same_calls_by_group(std::vector<int> calls, std::vector<int> expected) {
+    for (std::size_t i = 1; i < calls.size(); ++i) {
+        if (calls[i - 1] / 10 > calls[i] / 10) {
+            return false;
+        }
+    }
+    std::sort(calls.begin(), calls.end());
+    std::sort(expected.begin(), expected.end());
+    return calls == expected;
+}
+
+static void test_groups_merge() {
+    std::vector<int> calls;
+    auto make = [&] (int v) {
+        return std::function<void(int)>([&calls, v] (int) { calls.push_back(v); });
+    };
+
+    sigslot::signal<int> sig;
+    sig.connect(make(10), 1);
+    sig.connect(make(30), 3);
+    sig.connect(make(11), 1);
+
+    sig.connect_many(std::vector<std::function<void(int)>>{make(12), make(13)}, 1);
+    sig.connect_many(std::vector<std::function<void(int)>>{make(0), make(1)}, 0);
+    sig.connect_many(std::vector<std::function<void(int)>>{make(20)}, 2);
+    auto conns = sig.connect_many(std::vector<std::function<void(int)>>{make(40), make(41)}, 4);
+    sig.connect(make(31), 3);
+
+    sig(0);
+    assert(same_calls_by_group(calls, {0, 1, 10, 11, 12, 13, 20, 30, 31, 40, 41}));
+
+    // slot indices were kept up to date
+    conns[0].disconnect();
+    assert(sig.disconnect(3) == 2);
+    calls.clear();
+    sig(0);
+    assert(same_calls_by_group(calls, {0, 1, 10, 11, 12, 13, 20, 41}));
+}
+
+static void test_during_emission() {
+    int sum = 0;
+    std::vector<std::function<void(int)>> fns(10, [&] (int v) { sum += v; });
+
+    sigslot::signal<int> sig;
+    sig.connect([&] (int) {
+        if (sum == 0) {
+            sig.connect_many(fns);
+        }
+    });
+
+    // the ongoing emission does not see the new slots
+    sig(1);
+    assert(sum == 0);
+    sig(1);
+    assert(sum == 10);
+}
+
+static void test_inplace() {
+    int sum = 0;
+    std::vector<std::function<void(int)>> fns(5, [&] (int v) { sum += v; });
+
+    sigslot::inplace_signal<3, int> sig;
+    auto conns = sig.connect_many(fns);
+    assert(conns.size() == 5);
+    assert(conns[2].valid());
+    assert(!conns[3].valid() && !conns[4].valid());
+
+    sig(1);
+    assert(sum == 3);
+}
+
+static void test_empty_range() {
+    int sum = 0;
+    sigslot::signal<int> sig;
+    sig.connect([&] (int v) { sum += v; });
+
+    auto conns = sig.connect_many(std::vector<std::function<void(int)>>{});
+    assert(conns.empty());
+    assert(sig.slot_count() == 1);
+
+    sig(1);
+    assert(sum == 1);
+}
+
+int main() {
+    test_connect_many();
+    test_groups_merge();
+    test_during_emission();
+    test_inplace();
+    test_empty_range();
+    return 0;
+}
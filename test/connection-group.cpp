@@ -0,0 +1,256 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+static int sum = 0;
+
+void f1(int i) { sum += i; }
+
+struct s {
+    void f1(int i) { sum += i; }
+};
+
+static void test_scoped_group() {
+    sum = 0;
+    sigslot::signal<int> sig1, sig2;
+    sig1.connect(f1);
+
+    {
+        sigslot::scoped_connection_group group;
+        assert(group.empty());
+        for (int i = 0; i < 100; ++i) {
+            group += sig1.connect(f1, i % 3);
+            group.add(sig2.connect(f1));
+        }
+        assert(group.size() == 200);
+
+        sig1(1);
+        sig2(1);
+        assert(sum == 201);
+    }
+
+    assert(sig1.slot_count() == 1);
+    assert(sig2.slot_count() == 0);
+    sig1(1);
+    sig2(1);
+    assert(sum == 202);
+}
+
+static void test_disconnect() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    sigslot::scoped_connection_group group;
+
+    auto c1 = sig.connect(f1);
+    auto c2 = sig.connect(f1);
+    group += c1;
+    group += c2;
+    group += sigslot::connection();
+
+    // connections already disconnected are not counted
+    c1.disconnect();
+    assert(group.size() == 2);
+    assert(group.disconnect() == 1);
+    assert(group.empty());
+    assert(!c2.connected());
+    assert(sig.slot_count() == 0);
+
+    // a scoped connection handed over to a group does not disconnect anymore
+    {
+        sigslot::scoped_connection sc = sig.connect(f1);
+        group += std::move(sc);
+    }
+    sig(1);
+    assert(sum == 1);
+
+    sigslot::scoped_connection_group other = std::move(group);
+    group = std::move(other);
+    sig(1);
+    assert(sum == 2);
+
+    group = sigslot::scoped_connection_group();
+    sig(1);
+    assert(sum == 2);
+    assert(sig.slot_count() == 0);
+}
+
+static void test_during_emission() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    sigslot::scoped_connection_group group;
+
+    sig.connect([&] (int) { group.disconnect(); });
+    for (int i = 0; i < 10; ++i) {
+        group += sig.connect(f1);
+    }
+
+    // the detached slots are skipped by the ongoing emission
+    sig(1);
+    assert(sum == 0);
+    assert(sig.slot_count() == 1);
+
+    for (int i = 0; i < 10; ++i) {
+        group += sig.connect(f1);
+    }
+    sig(1);
+    assert(sum == 0);
+    assert(sig.slot_count() == 1);
+}
+
+static void test_indexed() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    sig.set_indexed(true);
+    s p;
+
+    sigslot::scoped_connection_group group;
+    for (int i = 0; i < 10; ++i) {
+        group += sig.connect(&s::f1, &p);
+    }
+    sig.connect(&s::f1, &p);
+    group.disconnect();
+
+    assert(sig.slot_count() == 1);
+    assert(sig.disconnect(&p) == 1);
+    sig(1);
+    assert(sum == 0);
+}
+
+template <typename Signal>
+static void test_policy() {
+    sum = 0;
+    Signal sig;
+    sig.connect(f1);
+    {
+        sigslot::scoped_connection_group group;
+        for (int i = 0; i < 3; ++i) {
+            group += sig.connect(f1);
+        }
+        sig(1);
+        assert(sum == 4);
+    }
+    assert(sig.slot_count() == 1);
+    sig(1);
+    assert(sum == 5);
+}
+
+static void test_observer() {
+    sum = 0;
+    struct o : sigslot::observer {
+        ~o() override { this->disconnect_all(); }
+        void slot(int i) { sum += i; }
+    };
+
+    sigslot::signal<int> sig1, sig2;
+    {
+        o obs;
+        for (int i = 0; i < 10; ++i) {
+            sig1.connect(&o::slot, &obs);
+            sig2.connect(&o::slot, &obs);
+        }
+        sig1(1);
+        sig2(1);
+        assert(sum == 20);
+    }
+    assert(sig1.slot_count() == 0);
+    assert(sig2.slot_count() == 0);
+}
+
+static void test_threaded() {
+    std::atomic<long> calls{0};
+    sigslot::signal<int> sig;
+    sig.connect([&] (int) { ++calls; });
+
+    std::atomic<bool> run{true};
+    std::vector<std::thread> emitters;
+    for (int i = 0; i < 4; ++i) {
+        emitters.emplace_back([&] {
+            while (run) {
+                sig(1);
+            }
+        });
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        sigslot::scoped_connection_group group;
+        for (int j = 0; j < 50; ++j) {
+            group += sig.connect([&] (int) { ++calls; });
+        }
+    }
+
+    run = false;
+    for (auto &t : emitters) {
+        t.join();
+    }
+
+    assert(sig.slot_count() == 1);
+    const long before = calls;
+    sig(1);
+    assert(calls == before + 1);
+}
+
+static void test_concurrent_disconnection() {
+    for (int round = 0; round < 20; ++round) {
+        sigslot::signal<int> sig;
+        std::atomic<bool> emitting{false};
+        std::atomic<bool> release{false};
+        sig.connect([&] (int) {
+            emitting = true;
+            while (!release) {
+                std::this_thread::yield();
+            }
+        });
+
+        std::vector<sigslot::connection> singles;
+        sigslot::scoped_connection_group group;
+        for (int i = 0; i < 100; ++i) {
+            auto c = sig.connect(f1);
+            singles.push_back(c);
+            group += sigslot::scoped_connection(c);
+        }
+        for (int i = 0; i < 100; ++i) {
+            group += sig.connect(f1);
+        }
+        for (int i = 0; i < 300; ++i) {
+            sig.connect(f1);
+        }
+
+        // the list is shared with the emission, disconnected slots become
+        // tombstones, each of which must be counted exactly once
+        std::thread emitter([&] { sig(1); });
+        while (!emitting) {
+            std::this_thread::yield();
+        }
+
+        std::thread single([&] {
+            for (auto &c : singles) {
+                c.disconnect();
+            }
+        });
+        group.disconnect();
+        single.join();
+        assert(sig.slot_count() == 301);
+
+        release = true;
+        emitter.join();
+        assert(sig.slot_count() == 301);
+    }
+}
+
+int main() {
+    test_scoped_group();
+    test_disconnect();
+    test_during_emission();
+    test_indexed();
+    test_policy<sigslot::signal_st<int>>();
+    test_policy<sigslot::signal_rcu<int>>();
+    test_policy<sigslot::signal_cached<int>>();
+    test_policy<sigslot::inplace_signal<8, int>>();
+    test_observer();
+    test_threaded();
+    test_concurrent_disconnection();
+    return 0;
+}
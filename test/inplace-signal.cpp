@@ -0,0 +1,211 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// count the calls to the global allocator
+static std::atomic<std::size_t> allocations{0};
+
+void * operator new(std::size_t n) {
+    allocations++;
+    if (void *p = std::malloc(n ? n : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+static int sum = 0;
+
+static void f1(int i) { sum += i; }
+static void f2(int i) { sum += 2*i; }
+
+struct s {
+    void m(int i) { sum += 3*i; }
+};
+
+static void test_inplace_emission() {
+    sum = 0;
+    s p;
+    sigslot::inplace_signal<4, int> sig;
+    sig.connect(f1);
+    sig.connect(&s::m, &p);
+    sig.connect([] (int i) { sum += 4*i; });
+    assert(sig.slot_count() == 3);
+
+    sig(1);
+    assert(sum == 8);
+}
+
+static void test_inplace_capacity() {
+    sum = 0;
+    sigslot::inplace_signal<2, int> sig;
+
+    auto c1 = sig.connect(f1);
+    auto c2 = sig.connect(f2);
+    assert(c1.valid());
+    assert(c2.valid());
+
+    // the signal is full
+    auto c3 = sig.connect(f1);
+    assert(!c3.valid());
+    assert(sig.slot_count() == 2);
+
+    sig(1);
+    assert(sum == 3);
+
+    // room is made by disconnection, once no connection refers to the slot
+    c1.disconnect();
+    assert(!sig.connect(f2).valid());
+    c1 = sigslot::connection();
+    c3 = sig.connect(f2);
+    assert(c3.valid());
+    assert(!sig.connect(f2).valid());
+
+    sig(1);
+    assert(sum == 7);
+
+    c2.disconnect();
+    c2 = sigslot::connection();
+    c1 = sig.connect(f1);
+    assert(c1.valid());
+
+    sig(1);
+    assert(sum == 10);
+}
+
+static void test_inplace_pinned_blocks() {
+    sum = 0;
+    sigslot::inplace_signal<2, int> sig;
+
+    auto c1 = sig.connect(f1);
+    auto c2 = sig.connect(f2);
+    c1.disconnect();
+    c2.disconnect();
+    assert(sig.slot_count() == 0);
+
+    // every block is held by a connection to a disconnected slot, connecting
+    // fails instead of allocating
+    const auto before = allocations.load();
+    assert(!sig.connect(f1).valid());
+    assert(!sig.connect_extended([] (sigslot::connection &, int) {}).valid());
+    assert(allocations.load() == before);
+
+    sig(1);
+    assert(sum == 0);
+
+    c2 = sigslot::connection();
+    c2 = sig.connect(f2);
+    assert(c2.valid());
+    assert(!sig.connect(f1).valid());
+
+    sig(1);
+    assert(sum == 2);
+}
+
+static void test_inplace_no_allocation() {
+    sum = 0;
+
+    {
+        // the slot storage is allocated by the constructor of the signal, in
+        // a single piece
+        const auto constructed = allocations.load();
+        sigslot::inplace_signal<8, int> sig;
+        assert(allocations.load() == constructed + 1);
+        const auto before = allocations.load();
+        for (int i = 0; i < 1000; ++i) {
+            sigslot::scoped_connection c1 = sig.connect(f1, i % 5);
+            sigslot::scoped_connection c2 = sig.connect([] (int i) { sum += i; }, i % 7);
+            sig(1);
+            sig.disconnect(f1);
+        }
+        assert(allocations.load() == before);
+    }
+
+    assert(sum == 2000);
+}
+
+static void test_inplace_groups() {
+    std::string res;
+    sigslot::inplace_signal<3, int> sig;
+
+    // more distinct groups than slots over time
+    for (int i = 0; i < 10; ++i) {
+        sig.connect([] (int) {}, i);
+        sig.disconnect(i);
+    }
+
+    sig.connect([&] (int) { res += "c"; }, 12);
+    sig.connect([&] (int) { res += "a"; }, -3);
+    sig.connect([&] (int) { res += "b"; }, 5);
+    sig(0);
+    assert(res == "abc");
+}
+
+static void test_inplace_extended() {
+    sum = 0;
+    sigslot::inplace_signal<2, int> sig;
+
+    sig.connect_extended([] (sigslot::connection &c, int i) {
+        sum += i;
+        c.disconnect();
+    });
+
+    sig(1);
+    sig(1);
+    assert(sum == 1);
+    assert(sig.slot_count() == 0);
+}
+
+static void test_inplace_blocking() {
+    sum = 0;
+    sigslot::inplace_signal<2, int> sig;
+
+    auto c = sig.connect(f1);
+    {
+        sigslot::connection_blocker b = c.blocker();
+        sig(1);
+    }
+    sig(1);
+    assert(sum == 1);
+}
+
+static void test_inplace_connection_outliving() {
+    sum = 0;
+    sigslot::connection c1;
+    sigslot::scoped_connection c2;
+    {
+        sigslot::inplace_signal<2, int> sig;
+        c1 = sig.connect(f1);
+        c2 = sig.connect(f2);
+        sig(1);
+        assert(sum == 3);
+    }
+
+    assert(!c1.connected());
+    assert(!c1.valid());
+    assert(!c2.connected());
+    assert(!c1.disconnect());
+}
+
+int main() {
+    test_inplace_emission();
+    test_inplace_capacity();
+    test_inplace_pinned_blocks();
+    test_inplace_no_allocation();
+    test_inplace_groups();
+    test_inplace_extended();
+    test_inplace_blocking();
+    test_inplace_connection_outliving();
+    return 0;
+}
@@ -1,6 +1,11 @@
 #include "test-common.h"
 #include <sigslot/signal.hpp>
+#include <algorithm>
 #include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 template <typename T>
 struct object {
@@ -52,9 +57,174 @@ void test_self_recursive() {
     assert(i == 10);
 }
 
+void test_trampolined_recursive() {
+    object<int> i1(-1);
+    object<int> i2(10);
+    i1.sig.set_max_depth(1);
+    i2.sig.set_max_depth(1);
+
+    i1.sig.connect(&object<int>::dec_val, &i2);
+    i2.sig.connect(&object<int>::inc_val, &i1);
+
+    i1.inc_val(0);
+
+    assert(i1.v == i2.v);
+}
+
+void test_trampolined_deep() {
+    // would overflow the stack if run recursively
+    const int count = 1000000;
+    int i = 0;
+    int depth = 0;
+    int max_depth = 0;
+
+    sigslot::signal<int> s;
+    s.set_max_depth(1);
+    s.connect([&] (int v) {
+        ++depth;
+        max_depth = std::max(max_depth, depth);
+        if (i < count) {
+            i++;
+            s(v+1);
+        }
+        --depth;
+    });
+
+    s(0);
+
+    assert(i == count);
+    assert(max_depth == 1);
+}
+
+void test_trampolined_order() {
+    std::vector<int> order;
+
+    sigslot::signal<int> s;
+    s.set_max_depth(1);
+    s.connect([&] (int v) {
+        order.push_back(v);
+        if (v < 3) {
+            s(v*2+1);
+            s(v*2+2);
+        }
+    });
+
+    s(0);
+
+    // deferred emissions run in order, breadth first
+    assert((order == std::vector<int>{0, 1, 2, 3, 4, 5, 6}));
+}
+
+void test_trampolined_max_depth() {
+    int i = 0;
+    int depth = 0;
+    int max_depth = 0;
+
+    sigslot::signal<int> s;
+    s.set_max_depth(3);
+    assert(s.max_depth() == 3);
+    s.connect([&] (int v) {
+        ++depth;
+        max_depth = std::max(max_depth, depth);
+        if (i < 100) {
+            i++;
+            s(v+1);
+        }
+        --depth;
+    });
+
+    s(0);
+
+    assert(i == 100);
+    assert(max_depth == 3);
+}
+
+void test_trampolined_throw() {
+    int calls = 0;
+
+    sigslot::signal<int> s;
+    s.set_max_depth(1);
+    s.connect([&] (int v) {
+        ++calls;
+        if (v == 0) {
+            s(1);
+            throw std::runtime_error("slot");
+        }
+    });
+
+    bool thrown = false;
+    try {
+        s(0);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+
+    // the deferred emission was dropped
+    assert(thrown);
+    assert(calls == 1);
+    s(2);
+    assert(calls == 2);
+}
+
+void test_trampolined_destroyed() {
+    int calls = 0;
+
+    sigslot::signal<> s;
+    s.set_max_depth(1);
+    s.connect([&] {
+        auto inner = std::make_unique<sigslot::signal<>>();
+        inner->set_max_depth(1);
+        inner->connect([&] { ++calls; });
+        (*inner)();
+    });
+
+    // the deferred emission of the destroyed signal is dropped
+    s();
+    assert(calls == 0);
+}
+
+void test_trampolined_arguments() {
+    // signals whose emissions cannot be deferred still emit right away
+    int sum = 0;
+    sigslot::signal<std::unique_ptr<int>> sig1;
+    sig1.connect([&] (const std::unique_ptr<int> &p) { sum += *p; });
+    sig1(std::make_unique<int>(1));
+    assert(sum == 1);
+
+    sigslot::signal<int &> sig2;
+    sig2.connect([] (int &i) { ++i; });
+    sig2(sum);
+    assert(sum == 2);
+
+    // const references get copied
+    std::vector<std::string> res;
+    sigslot::signal<const std::string &> sig3;
+    sig3.set_max_depth(1);
+    sig3.connect([&] (const std::string &s) {
+        res.push_back(s);
+        if (s.size() < 3) {
+            std::string next = s + "a";
+            sig3(next);
+        }
+    });
+    sig3("");
+    assert((res == std::vector<std::string>{"", "a", "aa", "aaa"}));
+
+    static_assert(!sigslot::detail::deferrable<std::unique_ptr<int>>::value, "");
+    static_assert(!sigslot::detail::deferrable<int, int &>::value, "");
+    static_assert(sigslot::detail::deferrable<int, const std::string &>::value, "");
+}
+
 int main() {
     test_recursive();
     test_self_recursive();
+    test_trampolined_recursive();
+    test_trampolined_deep();
+    test_trampolined_order();
+    test_trampolined_max_depth();
+    test_trampolined_throw();
+    test_trampolined_destroyed();
+    test_trampolined_arguments();
     return 0;
 }
 
@@ -0,0 +1,147 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <array>
+#include <cassert>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+static int sum = 0;
+
+static void f1(int i) { sum += i; }
+static void f2(int i) { sum += 2*i; }
+
+template <typename Sig>
+static void test_batch_emission() {
+    sum = 0;
+    Sig sig;
+    sig.connect(f1);
+    sig.connect(f2);
+
+    std::vector<int> items{1, 2, 3};
+    sig.emit_batch(items);
+    assert(sum == 18);
+
+    sig.emit_batch(std::array<int, 2>{{1, 1}});
+    assert(sum == 24);
+}
+
+template <typename Sig>
+static void test_batch_order() {
+    std::string res;
+    Sig sig;
+    sig.connect([&] (int i) { res += "b" + std::to_string(i); }, 1);
+    sig.connect([&] (int i) { res += "a" + std::to_string(i); }, -1);
+
+    // each slot is called for all the items, groups in order
+    sig.emit_batch(std::vector<int>{1, 2});
+    assert(res == "a1a2b1b2");
+}
+
+static void test_batch_arguments() {
+    std::string res;
+    sigslot::signal<const std::string &, int> sig;
+    sig.connect([&] (const std::string &s, int i) { res += s + std::to_string(i); });
+
+    std::vector<std::tuple<std::string, int>> items{{"a", 1}, {"b", 2}};
+    sig.emit_batch(items);
+    assert(res == "a1b2");
+
+    std::vector<std::pair<const char *, int>> pairs{{"c", 3}};
+    sig.emit_batch(pairs);
+    assert(res == "a1b2c3");
+}
+
+static void test_batch_reference_arguments() {
+    sigslot::signal<int &> sig;
+    sig.connect([] (int &i) { i *= 2; });
+    sig.connect([] (int &i) { i += 1; });
+
+    std::vector<int> items{1, 2, 3};
+    sig.emit_batch(items);
+    assert((items == std::vector<int>{3, 5, 7}));
+}
+
+// a range whose iterators yield their items by value
+struct iota_range {
+    struct iterator {
+        int i;
+        int operator*() const { return i; }
+        iterator & operator++() { ++i; return *this; }
+        bool operator!=(const iterator &o) const { return i != o.i; }
+    };
+
+    iterator begin() const { return {first}; }
+    iterator end() const { return {last}; }
+
+    int first;
+    int last;
+};
+
+static void test_batch_value_items() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    sig.connect(f1);
+    sig.connect(f2);
+
+    sig.emit_batch(iota_range{1, 4});
+    assert(sum == 18);
+
+    // proxy references
+    int count = 0;
+    sigslot::signal<bool> sig2;
+    sig2.connect([&] (bool b) { count += b; });
+    sig2.emit_batch(std::vector<bool>{true, false, true});
+    assert(count == 2);
+}
+
+static void test_batch_blocking() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    auto c = sig.connect(f1);
+
+    std::vector<int> items{1, 2, 3};
+    sig.block();
+    sig.emit_batch(items);
+    assert(sum == 0);
+
+    sig.unblock();
+    c.block();
+    sig.emit_batch(items);
+    assert(sum == 0);
+
+    c.unblock();
+    sig.emit_batch(items);
+    assert(sum == 6);
+}
+
+static void test_batch_disconnection() {
+    sum = 0;
+    sigslot::signal<int> sig;
+
+    // a slot disconnecting itself misses the rest of the batch
+    sig.connect_extended([] (sigslot::connection &c, int i) {
+        sum += i;
+        c.disconnect();
+    });
+
+    sig.emit_batch(std::vector<int>{1, 2, 3});
+    assert(sum == 1);
+}
+
+int main() {
+    test_batch_emission<sigslot::signal_st<int>>();
+    test_batch_emission<sigslot::signal<int>>();
+    test_batch_emission<sigslot::signal_rcu<int>>();
+    test_batch_emission<sigslot::signal_cached<int>>();
+    test_batch_emission<sigslot::inplace_signal<4, int>>();
+    test_batch_order<sigslot::signal_st<int>>();
+    test_batch_order<sigslot::signal<int>>();
+    test_batch_arguments();
+    test_batch_reference_arguments();
+    test_batch_value_items();
+    test_batch_blocking();
+    test_batch_disconnection();
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <thread>
+
+static std::atomic<std::int64_t> sum{0};
+
+static void f1(int i) { sum += i; }
+static void f2(int i) { sum += 2*i; }
+
+static void test_cached_connection() {
+    sum = 0;
+    sigslot::signal_cached<int> sig;
+
+    auto c1 = sig.connect(f1);
+    sig(1);
+    sig(1);
+    assert(sum == 2);
+
+    // the cached slot list must be refreshed after a modification
+    sig.connect(f2);
+    sig(1);
+    assert(sum == 5);
+
+    c1.disconnect();
+    sig(1);
+    assert(sum == 7);
+    assert(sig.slot_count() == 1);
+
+    sig.disconnect_all();
+    sig(1);
+    assert(sum == 7);
+}
+
+static void test_cached_slot_destruction() {
+    sigslot::signal_cached<> sig;
+    auto p = std::make_shared<int>(0);
+
+    auto c = sig.connect([p] {});
+    sig();
+    assert(p.use_count() == 2);
+
+    // the handle cached by the disconnecting thread is dropped
+    c.disconnect();
+    assert(p.use_count() == 1);
+}
+
+static void test_cached_modification_in_slot() {
+    int count = 0;
+    sigslot::signal_cached<int> sig;
+
+    sig.connect_extended([&] (sigslot::connection &c, int v) {
+        c.disconnect();
+        sig.connect([&] (int) { count++; });
+        // nested emission while the outer one still uses the cached list
+        sig(v);
+    });
+
+    sig(0);
+    assert(count == 1);
+    sig(0);
+    assert(count == 2);
+}
+
+static void test_cached_many_signals() {
+    sum = 0;
+    std::array<sigslot::signal_cached<int>, 32> sigs;
+    for (auto &s : sigs) {
+        s.connect(f1);
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        for (auto &s : sigs) {
+            s(1);
+        }
+    }
+
+    assert(sum == 96);
+}
+
+// destroyed after the thread cache of the main thread
+static sigslot::signal_cached<int> static_sig;
+
+static void test_cached_static() {
+    sum = 0;
+    static_sig.connect(f1);
+    static_sig(1);
+    assert(sum == 1);
+}
+
+static void test_cached_threaded() {
+    sum = 0;
+    sigslot::signal_cached<int> sig;
+    std::atomic<bool> run{true};
+    sig.connect(f1);
+
+    auto emitter = [&] {
+        for (int i = 0; i < 10000; ++i) {
+            sig(1);
+        }
+    };
+
+    auto conn = [&] {
+        while (run) {
+            sigslot::scoped_connection c = sig.connect([] (int) {});
+        }
+    };
+
+    std::array<std::thread, 8> emitters;
+    std::thread connecter(conn);
+
+    for (auto &t : emitters)
+        t = std::thread(emitter);
+    for (auto &t : emitters)
+        t.join();
+
+    run = false;
+    connecter.join();
+
+    assert(sum == 80000);
+}
+
+int main() {
+    test_cached_connection();
+    test_cached_slot_destruction();
+    test_cached_modification_in_slot();
+    test_cached_many_signals();
+    test_cached_static();
+    test_cached_threaded();
+    return 0;
+}
@@ -0,0 +1,207 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <memory>
+#include <string>
+
+#ifdef SIGSLOT_COROUTINES_ENABLED
+
+#include <coroutine>
+#include <exception>
+#include <tuple>
+
+// an eagerly started coroutine, whose frame is destroyed along with the task
+struct task {
+    struct promise_type {
+        task get_return_object() {
+            return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    explicit task(std::coroutine_handle<promise_type> h) : handle{h} {}
+    task(const task &) = delete;
+    ~task() { handle.destroy(); }
+
+    bool done() const { return handle.done(); }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+template <typename Sig>
+static task wait_int(Sig &sig, int &res) {
+    res = co_await sig.next();
+}
+
+static void test_awaiting_next_emission() {
+    int res = 0;
+    sigslot::signal<int> sig;
+    task t = wait_int(sig, res);
+
+    assert(!t.done());
+    assert(sig.slot_count() == 1);
+
+    sig(1);
+    assert(t.done());
+    assert(res == 1);
+    assert(sig.slot_count() == 0);
+
+    // the slot was one-shot
+    sig(2);
+    assert(res == 1);
+}
+
+static task wait_loop(sigslot::signal<int> &sig, int &sum) {
+    for (;;) {
+        int i = co_await sig.next();
+        if (i == 0) {
+            break;
+        }
+        sum += i;
+    }
+}
+
+static void test_awaiting_in_loop() {
+    int sum = 0;
+    sigslot::signal<int> sig;
+    task t = wait_loop(sig, sum);
+
+    sig(1);
+    sig(2);
+    sig(3);
+    assert(!t.done());
+    assert(sig.slot_count() == 1);
+
+    sig(0);
+    assert(t.done());
+    assert(sum == 6);
+    assert(sig.slot_count() == 0);
+}
+
+static task wait_void(sigslot::signal<> &sig, int &count) {
+    co_await sig.next();
+    ++count;
+}
+
+static task wait_many(sigslot::signal<int, const std::string &> &sig,
+                      int &i, std::string &s) {
+    std::tie(i, s) = co_await sig.next();
+}
+
+static void test_awaited_values() {
+    int count = 0;
+    sigslot::signal<> sig0;
+    task t0 = wait_void(sig0, count);
+    sig0();
+    assert(count == 1);
+
+    int i = 0;
+    std::string s;
+    sigslot::signal<int, const std::string &> sig2;
+    task t2 = wait_many(sig2, i, s);
+    {
+        std::string arg = "foo";
+        sig2(1, arg);
+        arg = "bar";
+    }
+    assert(i == 1);
+    assert(s == "foo");
+}
+
+static void test_awaiting_along_slots() {
+    int res = 0;
+    int direct = 0;
+    sigslot::signal<int> sig;
+    sig.connect([&] (int i) { direct += i; });
+    task t = wait_int(sig, res);
+
+    sig(2);
+    sig(2);
+    assert(res == 2);
+    assert(direct == 4);
+    assert(sig.slot_count() == 1);
+}
+
+static void test_destroyed_awaiter() {
+    int res = 0;
+    sigslot::signal<int> sig;
+
+    {
+        task t = wait_int(sig, res);
+        assert(sig.slot_count() == 1);
+    }
+
+    // destroying the suspended coroutine disconnects its slot
+    assert(sig.slot_count() == 0);
+    sig(1);
+    assert(res == 0);
+}
+
+static void test_destroyed_signal() {
+    int res = 0;
+    auto sig = std::make_unique<sigslot::signal<int>>();
+    task t = wait_int(*sig, res);
+
+    sig.reset();
+    assert(!t.done());
+    assert(res == 0);
+}
+
+static void test_single_threaded_signal() {
+    int res1 = 0;
+    int res2 = 0;
+    int direct = 0;
+    sigslot::signal_st<int> sig;
+    task t1 = wait_int(sig, res1);
+    task t2 = wait_int(sig, res2);
+    sig.connect([&] (int i) { direct += i; });
+
+    // the awaiting slots disconnect themselves from the list being emitted
+    sig(7);
+    assert(t1.done() && t2.done());
+    assert(res1 == 7 && res2 == 7);
+    assert(direct == 7);
+    assert(sig.slot_count() == 1);
+
+    sig(1);
+    assert(res1 == 7 && res2 == 7);
+    assert(direct == 8);
+}
+
+static void test_blocked_signal() {
+    int res = 0;
+    sigslot::signal<int> sig;
+    task t = wait_int(sig, res);
+
+    sig.block();
+    sig(1);
+    assert(!t.done());
+
+    sig.unblock();
+    sig(2);
+    assert(t.done());
+    assert(res == 2);
+}
+
+int main() {
+    test_awaiting_next_emission();
+    test_awaiting_in_loop();
+    test_awaited_values();
+    test_awaiting_along_slots();
+    test_destroyed_awaiter();
+    test_destroyed_signal();
+    test_single_threaded_signal();
+    test_blocked_signal();
+    return 0;
+}
+
+#else
+
+int main() {
+    return 0;
+}
+
+#endif
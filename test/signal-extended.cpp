@@ -1,6 +1,8 @@
 #include "test-common.h"
 #include <sigslot/signal.hpp>
 #include <cassert>
+#include <memory>
+#include <vector>
 
 static int sum = 0;
 
@@ -117,10 +119,106 @@ void test_lambda_connection() {
     assert(sum == 3);
 }
 
+void test_one_shot_connections() {
+    int permanent = 0;
+    int once = 0;
+    auto res = std::make_shared<int>(0);
+
+    sigslot::signal<int> sig;
+    for (int i = 0; i < 100; ++i) {
+        sig.connect([&] (int v) { permanent += v; });
+        if (i % 2 == 0) {
+            sig.connect_extended([&, res] (sigslot::connection &c, int v) {
+                once += v;
+                c.disconnect();
+            });
+        }
+    }
+    assert(sig.slot_count() == 150);
+    assert(res.use_count() == 51);
+
+    // disconnected slots are left in place during emission, then swept
+    sig(1);
+    assert(permanent == 100 && once == 50);
+    assert(sig.slot_count() == 100);
+    assert(res.use_count() == 1);
+
+    sig(1);
+    assert(permanent == 200 && once == 50);
+}
+
+void test_changes_during_emission() {
+    int sum = 0;
+    std::vector<sigslot::connection> conns;
+
+    sigslot::signal<int> sig;
+    for (int i = 0; i < 10; ++i) {
+        conns.push_back(sig.connect([&] (int v) { sum += v; }, i));
+    }
+    sig.connect([&] (int) {
+        // disconnect slots yet to be called, then connect a new one
+        conns[5].disconnect();
+        conns[6].disconnect();
+        sig.connect([&] (int v) { sum += 100 * v; }, 20);
+    }, 3);
+
+    sig(1);
+    assert(sum == 8);
+    assert(sig.slot_count() == 10);
+
+    sum = 0;
+    sig(1);
+    assert(sum == 108);
+}
+
+void test_destruction_in_nested_emission() {
+    int sum = 0;
+    auto sig = std::make_unique<sigslot::signal<int>>();
+
+    sig->connect_extended([&] (sigslot::connection &c, int v) {
+        if (v > 0) {
+            (*sig)(v - 1);
+        } else {
+            // leave a tombstone behind, then destroy the signal while the
+            // outer emission still shares its slot list
+            c.disconnect();
+            sig.reset();
+        }
+    });
+    sig->connect([&] (int v) { sum += v; });
+
+    (*sig)(1);
+    assert(!sig);
+}
+
+void test_one_shot_connections_in_nested_emission() {
+    int once = 0;
+    auto res = std::make_shared<int>(0);
+
+    sigslot::signal<> a;
+    sigslot::signal<> b;
+    a.connect_extended([&, res] (sigslot::connection &c) {
+        ++once;
+        c.disconnect();
+    });
+    a.connect([] {});
+    b.connect([&] { a(); });
+
+    // the emission of a, nested in a slot of b, sweeps the disconnected slot
+    b();
+    assert(once == 1);
+    assert(a.slot_count() == 1);
+    assert(res.use_count() == 1);
+}
+
 int main() {
     test_free_connection();
     test_static_connection();
     test_pmf_connection();
     test_function_object_connection();
     test_lambda_connection();
+    test_one_shot_connections();
+    test_changes_during_emission();
+    test_destruction_in_nested_emission();
+    test_one_shot_connections_in_nested_emission();
 }
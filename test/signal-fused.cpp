@@ -0,0 +1,255 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+static void test_chain() {
+    std::vector<int> calls;
+    sigslot::signal<int> sigs[5];
+
+    for (int i = 0; i < 5; ++i) {
+        sigs[i].connect([&calls, i] (int v) { calls.push_back(i * 10 + v); });
+        if (i > 0) {
+            sigslot::connect_fused(sigs[i - 1], sigs[i]);
+        }
+    }
+
+    sigs[0](1);
+    assert((calls == std::vector<int>{1, 11, 21, 31, 41}));
+
+    // emitting a signal in the middle of the chain only reaches downstream
+    calls.clear();
+    sigs[3](2);
+    assert((calls == std::vector<int>{32, 42}));
+}
+
+static void test_downstream_changes() {
+    int sum = 0;
+    sigslot::signal<int> sig1, sig2, sig3;
+    sigslot::connect_fused(sig1, sig2);
+    sigslot::connect_fused(sig2, sig3);
+
+    sig1(1);
+    assert(sum == 0);
+
+    auto c1 = sig3.connect([&] (int v) { sum += v; });
+    sig1(1);
+    assert(sum == 1);
+
+    auto c2 = sig2.connect([&] (int v) { sum += 10 * v; });
+    sig1(1);
+    assert(sum == 12);
+
+    c1.disconnect();
+    sig1(1);
+    assert(sum == 22);
+
+    sig2.disconnect_all();
+    sig1(1);
+    assert(sum == 22);
+}
+
+static void test_blocking() {
+    int sum = 0;
+    sigslot::signal<int> sig1, sig2, sig3;
+    auto link = sigslot::connect_fused(sig1, sig2);
+    sigslot::connect_fused(sig2, sig3);
+    sig1.connect([&] (int v) { sum += v; });
+    sig2.connect([&] (int v) { sum += 10 * v; });
+    sig3.connect([&] (int v) { sum += 100 * v; });
+
+    sig1(1);
+    assert(sum == 111);
+
+    sig3.block();
+    sig1(1);
+    assert(sum == 122);
+    sig3.unblock();
+
+    link.block();
+    sig1(1);
+    assert(sum == 123);
+    link.unblock();
+
+    sig2.block();
+    sig1(1);
+    assert(sum == 124);
+    sig2.unblock();
+
+    sig1(1);
+    assert(sum == 235);
+
+    link.disconnect();
+    sig1(1);
+    assert(sum == 236);
+}
+
+static void test_groups() {
+    std::string order;
+    sigslot::signal<> sig1, sig2;
+    sig1.connect([&] { order += 'c'; }, 2);
+    sig1.connect([&] { order += 'a'; }, 0);
+    sigslot::connect_fused(sig1, sig2, 1);
+    sig2.connect([&] { order += 'b'; });
+
+    sig1();
+    assert(order == "abc");
+}
+
+static void test_disconnect_object() {
+    int sum = 0;
+    sigslot::signal<int> sig1, sig2;
+    sigslot::connect_fused(sig1, sig2);
+    sig2.connect([&] (int v) { sum += v; });
+
+    sig1(1);
+    assert(sum == 1);
+    assert(sig1.disconnect(&sig2) == 1);
+    sig1(1);
+    assert(sum == 1);
+}
+
+static void test_mixed_policies() {
+    int sum = 0;
+    sigslot::signal_st<int> sig1;
+    sigslot::signal_rcu<int> sig2;
+    sigslot::signal_cached<int> sig3;
+    sigslot::connect_fused(sig1, sig2);
+    sigslot::connect_fused(sig2, sig3);
+    sig3.connect([&] (int v) { sum += v; });
+
+    sig1(2);
+    assert(sum == 2);
+}
+
+static void test_recursive() {
+    int depth = 0;
+    int calls = 0;
+    sigslot::signal<int> sig1, sig2;
+    sigslot::connect_fused(sig1, sig2);
+    sig2.connect([&] (int v) {
+        ++calls;
+        if (v > 0) {
+            ++depth;
+            sig1(v - 1);
+        }
+    });
+    sig1(3);
+    assert(calls == 4);
+    assert(depth == 3);
+}
+
+static void test_other_emissions() {
+    std::vector<std::string> sink;
+    sigslot::signal<std::string> sig1, sig2;
+    sigslot::connect_fused(sig1, sig2);
+    sig2.connect([&] (std::string s) { sink.push_back(std::move(s)); });
+
+    sig1.emit_move(std::string(50, 'a'));
+    assert(sink.size() == 1 && sink.back() == std::string(50, 'a'));
+
+    sig1.emit_batch(std::vector<std::string>{"b", "c"});
+    assert(sink.size() == 3 && sink.back() == "c");
+}
+
+static void test_threaded() {
+    std::atomic<long> sum{0};
+    sigslot::signal<int> sig1, sig2, sig3;
+    sigslot::connect_fused(sig1, sig2);
+    sigslot::connect_fused(sig2, sig3);
+    sig3.connect([&] (int v) { sum += v; });
+
+    std::atomic<bool> run{true};
+    std::vector<std::thread> emitters;
+    for (int i = 0; i < 4; ++i) {
+        emitters.emplace_back([&] {
+            while (run) {
+                sig1(1);
+            }
+        });
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        auto c = sig3.connect([&] (int v) { sum += v; });
+        sig2.block();
+        sig2.unblock();
+        c.disconnect();
+    }
+
+    run = false;
+    for (auto &t : emitters) {
+        t.join();
+    }
+
+    // all the changes are seen once they are done
+    const long before = sum;
+    sig1(1);
+    assert(sum == before + 1);
+}
+
+static void test_captured_state_release() {
+    int sum = 0;
+    auto res = std::make_shared<int>(0);
+    sigslot::signal<int> sig1, sig2;
+    sigslot::connect_fused(sig1, sig2);
+    auto c = sig2.connect([&, res] (int v) { sum += v; });
+
+    sig1(1);
+    assert(sum == 1);
+
+    // the list cached by this thread still refers to the disconnected slot,
+    // until the head of the chain gets emitted again
+    c.disconnect();
+    assert(res.use_count() == 2);
+    sig1(1);
+    assert(sum == 1);
+    assert(res.use_count() == 1);
+
+    // or until the threads that emitted it exit
+    c = sig2.connect([&, res] (int v) { sum += v; });
+    std::thread emitter([&] { sig1(1); });
+    emitter.join();
+    assert(sum == 2);
+    c.disconnect();
+    assert(res.use_count() == 1);
+
+    std::atomic<bool> emitted{false};
+    std::atomic<bool> done{false};
+    c = sig2.connect([&, res] (int v) { sum += v; });
+    emitter = std::thread([&] {
+        sig1(1);
+        emitted = true;
+        while (!done) {
+            std::this_thread::yield();
+        }
+    });
+    while (!emitted) {
+        std::this_thread::yield();
+    }
+    sig1(1);
+    c.disconnect();
+    sig1(1);
+    assert(res.use_count() == 2);
+    done = true;
+    emitter.join();
+    assert(res.use_count() == 1);
+    assert(sum == 4);
+}
+
+int main() {
+    test_chain();
+    test_downstream_changes();
+    test_blocking();
+    test_groups();
+    test_disconnect_object();
+    test_mixed_policies();
+    test_recursive();
+    test_other_emissions();
+    test_threaded();
+    test_captured_state_release();
+    return 0;
+}
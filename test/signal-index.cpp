@@ -0,0 +1,167 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+static int sum = 0;
+
+void f1(int i) { sum += i; }
+void f2(int i) { sum += 2*i; }
+
+struct s {
+    void f1(int i) { sum += i; }
+    void f2(int i) { sum += 2*i; }
+};
+
+static void test_disconnection_by_callable() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    sig.set_indexed(true);
+    assert(sig.indexed());
+
+    sig.connect(f1);
+    sig.connect(f2);
+    sig.connect(f2);
+    sig(1);
+    assert(sum == 5);
+    assert(sig.disconnect(&f2) == 2);
+    assert(sig.disconnect(&f2) == 0);
+    sig(1);
+    assert(sum == 6);
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    sum = 0;
+    auto l1 = [] (int i) { sum += i; };
+    auto l2 = [] (int i) { sum += 2*i; };
+    sig.connect(l1);
+    sig.connect(l2);
+    sig(1);
+    assert(sum == 4);
+    assert(sig.disconnect(l2) == 1);
+    sig(1);
+    assert(sum == 6);
+#endif
+}
+
+static void test_disconnection_by_object() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    s p1, p2;
+    auto p3 = std::make_shared<s>();
+
+    sig.connect(&s::f1, &p1);
+    sig.connect(&s::f2, &p1);
+    sig.connect(&s::f1, &p2);
+    sig.connect(&s::f1, p3);
+
+    // the index is built from the slots already connected
+    sig.set_indexed(true);
+
+    sig(1);
+    assert(sum == 5);
+    assert(sig.disconnect(&p1) == 2);
+    sig(1);
+    assert(sum == 7);
+    assert(sig.disconnect(p3) == 1);
+    sig(1);
+    assert(sum == 8);
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    sig.connect(&s::f2, &p2);
+    assert(sig.disconnect(&s::f2, &p2) == 1);
+    sig(1);
+    assert(sum == 9);
+#endif
+}
+
+static void test_tracked() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    sig.set_indexed(true);
+
+    auto t1 = std::make_shared<bool>();
+    auto t2 = std::make_shared<bool>();
+    sig.connect(f1, t1);
+    sig.connect(f2, t1);
+    sig.connect(f1, t2);
+    sig(1);
+    assert(sum == 4);
+    assert(sig.disconnect(f2, t1) == 1);
+    sig(1);
+    assert(sum == 6);
+
+    // expired objects leave the index along with their slots
+    t2.reset();
+    sig(1);
+    assert(sum == 7);
+    assert(sig.disconnect(&f1) == 1);
+    assert(sig.slot_count() == 0);
+}
+
+static void test_index_sync() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    sig.set_indexed(true);
+    s p;
+
+    auto c = sig.connect(&s::f1, &p);
+    sig.connect(&s::f1, &p, 1);
+    sig.connect(&s::f1, &p, 2);
+    sig.connect_extended([&] (sigslot::connection &conn, int i) {
+        sum += i;
+        conn.disconnect();
+    });
+    sig.connect_many(std::vector<void(*)(int)>{f1, f1});
+
+    c.disconnect();
+    assert(sig.disconnect(1) == 1);
+    sig(1);
+    assert(sum == 4);
+    assert(sig.disconnect(&p) == 1);
+    assert(sig.disconnect(&f1) == 2);
+    assert(sig.slot_count() == 0);
+
+    sig.connect(&s::f1, &p);
+    sig.disconnect_all();
+    assert(sig.disconnect(&p) == 0);
+
+    sig.set_indexed(false);
+    assert(!sig.indexed());
+    sig.connect(&s::f1, &p);
+    assert(sig.disconnect(&p) == 1);
+}
+
+static void test_many_slots() {
+    sigslot::signal<int> sig;
+    sig.set_indexed(true);
+
+    std::vector<s> objects(1000);
+    for (int i = 0; i < 50; ++i) {
+        for (auto &o : objects) {
+            sig.connect(&s::f1, &o, i % 4);
+        }
+    }
+
+    // the slots moved by the removals of the first half remain reachable
+    for (std::size_t i = 0; i < objects.size() / 2; ++i) {
+        assert(sig.disconnect(&objects[i]) == 50);
+    }
+    sum = 0;
+    sig(1);
+    assert(sum == 50 * 500);
+
+    for (std::size_t i = objects.size() / 2; i < objects.size(); ++i) {
+        assert(sig.disconnect(&objects[i]) == 50);
+    }
+    assert(sig.slot_count() == 0);
+}
+
+int main() {
+    test_disconnection_by_callable();
+    test_disconnection_by_object();
+    test_tracked();
+    test_index_sync();
+    test_many_slots();
+    return 0;
+}
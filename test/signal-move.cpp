@@ -0,0 +1,118 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <vector>
+
+// counts the copies and moves it goes through
+struct buffer {
+    buffer() = default;
+    buffer(const buffer &o) : data(o.data) { ++copies; }
+    buffer(buffer &&o) noexcept : data(std::move(o.data)) { ++moves; }
+    buffer & operator=(const buffer &o) { data = o.data; ++copies; return *this; }
+    buffer & operator=(buffer &&o) noexcept { data = std::move(o.data); ++moves; return *this; }
+
+    std::vector<int> data = std::vector<int>(64, 1);
+    static int copies;
+    static int moves;
+};
+
+int buffer::copies = 0;
+int buffer::moves = 0;
+
+static void reset() {
+    buffer::copies = 0;
+    buffer::moves = 0;
+}
+
+static void test_move_into_last_slot() {
+    std::vector<buffer> sink;
+    sigslot::signal<buffer> sig;
+    sig.connect([&] (const buffer &b) { assert(b.data.size() == 64); }, 0);
+    sig.connect([&] (buffer b) { sink.push_back(std::move(b)); }, 1);
+    sink.reserve(4);
+
+    reset();
+    sig.emit_move(buffer{});
+    assert(buffer::copies == 0);
+    assert(sink.size() == 1);
+    assert(sink.back().data.size() == 64);
+
+    // plain emission copies into the last slot
+    reset();
+    buffer b;
+    sig(b);
+    assert(buffer::copies == 1);
+}
+
+static void test_lvalue_copied_once() {
+    buffer moved_to;
+    sigslot::signal<buffer> sig;
+    sig.connect([&] (buffer b) { moved_to = std::move(b); });
+
+    buffer b;
+    reset();
+    sig.emit_move(b);
+    assert(buffer::copies == 1);
+    assert(buffer::moves == 2);
+    assert(b.data.size() == 64);
+    assert(moved_to.data.size() == 64);
+}
+
+static void test_skips_blocked_and_disconnected() {
+    int first = 0;
+    std::string last;
+    std::string other;
+    sigslot::signal<std::string> sig;
+    sig.connect([&] (const std::string &) { ++first; }, 0);
+    sig.connect([&] (std::string s) { last = std::move(s); }, 1);
+    auto c1 = sig.connect([&] (std::string s) { other = std::move(s); }, 2);
+    auto c2 = sig.connect([&] (std::string s) { other = std::move(s); }, 3);
+
+    c1.block();
+    c2.disconnect();
+
+    std::string arg(100, 'a');
+    sig.emit_move(std::move(arg));
+    assert(first == 1);
+    assert(last == std::string(100, 'a'));
+    assert(other.empty());
+}
+
+static void test_slot_kinds() {
+    struct s {
+        void take(std::string v) { value = std::move(v); }
+        std::string value;
+    };
+
+    auto obj = std::make_shared<s>();
+    sigslot::signal<std::string> sig;
+    sig.connect(&s::take, obj);
+    sig.emit_move(std::string(50, 'b'));
+    assert(obj->value == std::string(50, 'b'));
+
+    std::string ext;
+    sigslot::signal<std::string> sig2;
+    sig2.connect_extended([&] (sigslot::connection &, std::string v) { ext = std::move(v); });
+    sig2.emit_move(std::string(50, 'c'));
+    assert(ext == std::string(50, 'c'));
+}
+
+static void test_no_slot() {
+    sigslot::signal<buffer> sig;
+    sig.emit_move(buffer{});
+
+    auto c = sig.connect([] (buffer) { assert(false); });
+    c.block();
+    sig.emit_move(buffer{});
+}
+
+int main() {
+    test_move_into_last_slot();
+    test_lvalue_copied_once();
+    test_skips_blocked_and_disconnected();
+    test_slot_kinds();
+    test_no_slot();
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+template <typename Sig>
+static void test_parallel_emission() {
+    std::atomic<int> sum{0};
+    sigslot::emission_pool pool(3, 4);
+    Sig sig;
+
+    for (int i = 0; i < 1000; ++i) {
+        sig.connect([&] (int i) { sum += i; });
+    }
+
+    sig.emit_parallel(pool, 1);
+    sig.emit_parallel(pool, 2);
+    assert(sum == 3000);
+}
+
+static void test_parallel_group_order() {
+    constexpr int n = 200;
+    std::atomic<int> first{0};
+    std::atomic<int> second{0};
+    std::atomic<bool> ordered{true};
+    sigslot::emission_pool pool(3, 4);
+    sigslot::signal<> sig;
+
+    // every slot of a group sees the previous groups done
+    for (int i = 0; i < n; ++i) {
+        sig.connect([&] { ++first; }, 1);
+        sig.connect([&] {
+            if (first != n) {
+                ordered = false;
+            }
+            ++second;
+        }, 2);
+        sig.connect([&] {
+            if (second != n) {
+                ordered = false;
+            }
+        }, 3);
+    }
+
+    sig.emit_parallel(pool);
+    assert(ordered);
+    assert(second == n);
+}
+
+static void test_parallel_threshold() {
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+    sigslot::emission_pool pool(3, 100);
+    sigslot::signal<> sig;
+
+    for (int i = 0; i < 50; ++i) {
+        sig.connect([&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            ids.insert(std::this_thread::get_id());
+        });
+    }
+
+    // small groups run on the calling thread
+    sig.emit_parallel(pool);
+    assert(ids.size() == 1);
+    assert(*ids.begin() == std::this_thread::get_id());
+}
+
+static void test_parallel_exception() {
+    std::atomic<int> sum{0};
+    sigslot::emission_pool pool(2, 1);
+    sigslot::signal<int> sig;
+
+    for (int i = 0; i < 100; ++i) {
+        sig.connect([&] (int i) { sum += i; });
+    }
+    sig.connect([] (int) { throw std::runtime_error("slot"); });
+
+    bool thrown = false;
+    try {
+        sig.emit_parallel(pool, 1);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+
+    // the other slots of the group ran anyway
+    assert(thrown);
+    assert(sum == 100);
+}
+
+static void test_parallel_recursion() {
+    std::atomic<int> sum{0};
+    sigslot::emission_pool pool(2, 1);
+    sigslot::signal<int> sig;
+
+    // the nested emissions, the pool being busy, are run serially
+    for (int i = 0; i < 10; ++i) {
+        sig.connect([&] (int i) {
+            sum += 1;
+            if (i > 0) {
+                sig.emit_parallel(pool, i - 1);
+            }
+        });
+    }
+
+    sig.emit_parallel(pool, 1);
+    assert(sum == 110);
+}
+
+static void test_parallel_blocking() {
+    std::atomic<int> sum{0};
+    sigslot::emission_pool pool(2, 1);
+    sigslot::signal<int> sig;
+
+    auto c1 = sig.connect([&] (int i) { sum += i; });
+    sig.connect([&] (int i) { sum += 2*i; });
+
+    c1.block();
+    sig.emit_parallel(pool, 1);
+    assert(sum == 2);
+
+    sig.block();
+    sig.emit_parallel(pool, 1);
+    assert(sum == 2);
+}
+
+int main() {
+    test_parallel_emission<sigslot::signal_st<int>>();
+    test_parallel_emission<sigslot::signal<int>>();
+    test_parallel_emission<sigslot::signal_rcu<int>>();
+    test_parallel_emission<sigslot::signal_cached<int>>();
+    test_parallel_group_order();
+    test_parallel_threshold();
+    test_parallel_exception();
+    test_parallel_recursion();
+    test_parallel_blocking();
+    return 0;
+}
@@ -0,0 +1,216 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+static int sum = 0;
+
+static void f1(int i) { sum += i; }
+
+static void test_queued_call() {
+    sum = 0;
+    sigslot::event_queue q;
+    sigslot::signal<int> sig;
+    sig.connect_queued(q, f1);
+    sig.connect([] (int i) { sum += 10*i; });
+
+    // only the direct slot runs on emission
+    sig(1);
+    sig(2);
+    assert(sum == 30);
+
+    assert(q.process() == 2);
+    assert(sum == 33);
+    assert(q.process() == 0);
+}
+
+static void test_queued_argument_copy() {
+    std::string res;
+    sigslot::event_queue q;
+    sigslot::signal<const std::string &> sig;
+    sig.connect_queued(q, [&] (const std::string &s) { res += s; });
+
+    {
+        std::string s = "foo";
+        sig(s);
+        s = "bar";
+    }
+
+    q.process();
+    assert(res == "foo");
+}
+
+static void test_queued_disconnection() {
+    sum = 0;
+    sigslot::event_queue q;
+    sigslot::signal<int> sig;
+    auto c = sig.connect_queued(q, f1);
+
+    // the pending calls of a disconnected slot do not run
+    sig(1);
+    c.disconnect();
+    sig(1);
+    assert(q.process() == 1);
+    assert(sum == 0);
+}
+
+static void test_queued_blocking() {
+    sum = 0;
+    sigslot::event_queue q;
+    sigslot::signal<int> sig;
+    auto c = sig.connect_queued(q, f1);
+
+    sig(1);
+    c.block();
+    q.process();
+    assert(sum == 0);
+
+    sig(1);
+    c.unblock();
+    q.process();
+    assert(sum == 0);
+
+    sig(1);
+    q.process();
+    assert(sum == 1);
+}
+
+static void test_queued_tracking() {
+    sum = 0;
+    sigslot::event_queue q;
+    sigslot::signal<int> sig;
+    auto d = std::make_shared<int>(1);
+    auto c = sig.connect_queued(q, f1, d);
+
+    sig(1);
+    q.process();
+    assert(sum == 1);
+
+    // the object dies while a call is pending
+    sig(1);
+    d.reset();
+    q.process();
+    assert(sum == 1);
+    assert(!c.connected());
+}
+
+static void test_queued_outliving_signal() {
+    auto p = std::make_shared<int>(0);
+    sigslot::event_queue q;
+
+    {
+        sigslot::signal<int> sig;
+        sig.connect_queued(q, [p] (int i) { *p += i; });
+        sig(1);
+    }
+
+    // the slot is disconnected, the callable is released with the call
+    assert(p.use_count() == 2);
+    q.process();
+    assert(*p == 0);
+    assert(p.use_count() == 1);
+}
+
+static void test_queued_pending_on_destruction() {
+    auto p = std::make_shared<int>(0);
+    sigslot::signal<int> sig;
+
+    {
+        sigslot::event_queue q;
+        auto c = sig.connect_queued(q, [p] (int i) { *p += i; });
+        sig(1);
+        sig(1);
+        c.disconnect();
+    }
+
+    assert(*p == 0);
+    assert(p.use_count() == 1);
+}
+
+static void test_queued_process_max() {
+    sum = 0;
+    sigslot::event_queue q;
+    sigslot::signal<int> sig;
+    sig.connect_queued(q, f1);
+
+    for (int i = 0; i < 5; ++i) {
+        sig(1);
+    }
+
+    assert(q.process(2) == 2);
+    assert(sum == 2);
+    assert(q.process() == 3);
+    assert(sum == 5);
+}
+
+static void test_queued_notification() {
+    int notified = 0;
+    sigslot::event_queue q([&] { ++notified; });
+    sigslot::signal<int> sig;
+    sig.connect_queued(q, f1);
+
+    sig(1);
+    sig(1);
+    assert(notified == 2);
+    q.process();
+}
+
+static void test_queued_threaded() {
+    constexpr int emissions = 10000;
+    constexpr int threads = 4;
+    std::atomic<bool> done{false};
+    long total = 0;
+    std::thread::id consumer_id;
+
+    sigslot::event_queue q;
+    sigslot::signal<int> sig;
+    sig.connect_queued(q, [&] (int i) {
+        total += i;
+        consumer_id = std::this_thread::get_id();
+    });
+
+    std::thread consumer([&] {
+        while (!done) {
+            q.process();
+            std::this_thread::yield();
+        }
+        q.process();
+    });
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t) {
+        producers.emplace_back([&] {
+            for (int i = 0; i < emissions; ++i) {
+                sig(1);
+            }
+        });
+    }
+
+    for (auto &t : producers) {
+        t.join();
+    }
+    done = true;
+    const auto id = consumer.get_id();
+    consumer.join();
+
+    assert(total == emissions * threads);
+    assert(consumer_id == id);
+}
+
+int main() {
+    test_queued_call();
+    test_queued_argument_copy();
+    test_queued_disconnection();
+    test_queued_blocking();
+    test_queued_tracking();
+    test_queued_outliving_signal();
+    test_queued_pending_on_destruction();
+    test_queued_process_max();
+    test_queued_notification();
+    test_queued_threaded();
+    return 0;
+}
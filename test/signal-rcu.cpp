@@ -0,0 +1,200 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static std::atomic<std::int64_t> sum{0};
+
+static void f1(int i) { sum += i; }
+static void f2(int i) { sum += 2*i; }
+static void f3(int i) { sum += 3*i; }
+
+static void test_rcu_connection() {
+    sum = 0;
+    sigslot::signal_rcu<int> sig;
+
+    auto c1 = sig.connect(f1);
+    sig(1);
+    assert(sum == 1);
+
+    sig.connect(f2);
+    sig(1);
+    assert(sum == 4);
+    assert(sig.slot_count() == 2);
+
+    c1.disconnect();
+    assert(!c1.connected());
+    sig(1);
+    assert(sum == 6);
+
+    {
+        sigslot::scoped_connection sc = sig.connect(f3);
+        sig(1);
+        assert(sum == 11);
+    }
+
+    sig(1);
+    assert(sum == 13);
+
+    assert(sig.disconnect(f2) == 1);
+    sig(1);
+    assert(sum == 13);
+    assert(sig.slot_count() == 0);
+}
+
+static void test_rcu_groups() {
+    std::vector<int> res;
+    sigslot::signal_rcu<> sig;
+
+    sig.connect([&] { res.push_back(2); }, 2);
+    sig.connect([&] { res.push_back(0); }, -5);
+    sig.connect([&] { res.push_back(1); }, 1);
+    sig();
+
+    assert((res == std::vector<int>{0, 1, 2}));
+}
+
+static void test_rcu_reclamation() {
+    sigslot::signal_rcu<> sig;
+    auto p = std::make_shared<int>(0);
+
+    auto c = sig.connect([p] {});
+    assert(p.use_count() == 2);
+
+    // no reader is pinned, the former slot list is reclaimed right away
+    c.disconnect();
+    assert(p.use_count() == 1);
+}
+
+static void test_rcu_reclamation_after_emission() {
+    sigslot::signal_rcu<> sig;
+    auto p = std::make_shared<int>(0);
+
+    // the last change happens while the emitting thread is pinned
+    auto c = sig.connect([p] {});
+    sig.connect([&] { c.disconnect(); });
+    sig();
+    assert(p.use_count() == 1);
+}
+
+static void test_rcu_reclamation_out_of_lock() {
+    sum = 0;
+    sigslot::signal_rcu<int> sig;
+
+    // the destruction of the callable connects to the signal, which would
+    // deadlock if it happened under the lock of the signal
+    std::shared_ptr<int> p(new int(0), [&] (int *q) {
+        delete q;
+        sig.connect(f1);
+    });
+    auto c = sig.connect([p] (int) {});
+    p.reset();
+
+    c.disconnect();
+    sig(1);
+    assert(sum == 1);
+}
+
+static void test_rcu_recursive() {
+    int i = 0;
+    sigslot::signal_rcu<int> sig;
+
+    sig.connect_extended([&] (sigslot::connection &c, int v) {
+        if (i < 10) {
+            i++;
+            sig(v+1);
+        } else {
+            c.disconnect();
+        }
+    });
+
+    sig(0);
+    assert(i == 10);
+    assert(sig.slot_count() == 0);
+}
+
+static void test_rcu_destruction_in_slot() {
+    int i = 0;
+    auto sig = std::make_unique<sigslot::signal_rcu<>>();
+
+    sig->connect([&] { sig.reset(); });
+    sig->connect([&] { i++; });
+    (*sig)();
+
+    assert(!sig);
+}
+
+static void test_rcu_threaded_emission() {
+    sum = 0;
+    sigslot::signal_rcu<int> sig;
+    sig.connect(f1);
+
+    std::array<std::thread, 10> threads;
+    for (auto &t : threads) {
+        t = std::thread([&] {
+            for (int i = 0; i < 10000; ++i) {
+                sig(1);
+            }
+        });
+    }
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    assert(sum == 100000);
+}
+
+static void test_rcu_threaded_mix() {
+    sigslot::signal_rcu<int> sig;
+    std::atomic<bool> run{true};
+
+    auto emitter = [&] {
+        while (run) {
+            sig(1);
+        }
+    };
+
+    auto conn = [&] {
+        while (run) {
+            for (int i = 0; i < 10; ++i) {
+                sigslot::scoped_connection c = sig.connect(f1);
+                sig.connect(f2);
+            }
+            sig.disconnect(f2);
+        }
+    };
+
+    std::array<std::thread, 10> emitters;
+    std::array<std::thread, 4> conns;
+
+    for (auto &t : conns)
+        t = std::thread(conn);
+    for (auto &t : emitters)
+        t = std::thread(emitter);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    run = false;
+
+    for (auto &t : emitters)
+        t.join();
+    for (auto &t : conns)
+        t.join();
+}
+
+int main() {
+    test_rcu_connection();
+    test_rcu_groups();
+    test_rcu_reclamation();
+    test_rcu_reclamation_after_emission();
+    test_rcu_reclamation_out_of_lock();
+    test_rcu_recursive();
+    test_rcu_destruction_in_slot();
+    test_rcu_threaded_emission();
+    test_rcu_threaded_mix();
+    return 0;
+}
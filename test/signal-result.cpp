@@ -0,0 +1,171 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <vector>
+
+static int twice(int i) { return 2 * i; }
+
+struct o {
+    int add(int i) const { return i + v; }
+    int v = 1;
+};
+
+static void test_default_combiner() {
+    sigslot::signal_r<int(int)> sig;
+
+    // no slot
+    assert(sig(1) == 0);
+
+    sig.connect(twice);
+    assert(sig(2) == 4);
+
+    sig.connect([] (int i) { return i + 10; }, 1);
+    assert(sig(2) == 12);
+}
+
+static void test_sum() {
+    sigslot::signal_r<int(int), sigslot::combiner::sum<int>> sig;
+    sig.connect(twice);
+    sig.connect(twice);
+    sig.connect([] (int i) { return i; });
+    assert(sig(1) == 5);
+
+    sigslot::signal_r<int(int), sigslot::combiner::sum<int>> sig100(sigslot::combiner::sum<int>(100));
+    sig100.connect(twice);
+    assert(sig100(1) == 102);
+    assert(sig100(1) == 102);
+}
+
+static void test_min_max() {
+    sigslot::signal_r<int(int), sigslot::combiner::min<int>> smin;
+    sigslot::signal_r<int(int), sigslot::combiner::max<int>> smax;
+    for (int k : {3, -2, 7}) {
+        smin.connect([k] (int i) { return i * k; });
+        smax.connect([k] (int i) { return i * k; });
+    }
+
+    assert(smin(1) == -2);
+    assert(smax(1) == 7);
+    assert(smin(-1) == -7);
+    assert(smax(-1) == 2);
+
+    // the initial value is only returned without slots
+    sigslot::signal_r<int(int), sigslot::combiner::min<int>> sinit(sigslot::combiner::min<int>(-100));
+    assert(sinit(1) == -100);
+    sinit.connect(twice);
+    assert(sinit(1) == 2);
+}
+
+static void test_short_circuit() {
+    int calls = 0;
+    sigslot::signal_r<bool(int), sigslot::combiner::all_of> sall;
+    sigslot::signal_r<bool(int), sigslot::combiner::any_of> sany;
+    for (int k = 0; k < 4; ++k) {
+        sall.connect([&calls, k] (int i) { ++calls; return k < i; }, k);
+        sany.connect([&calls, k] (int i) { ++calls; return k >= i; }, k);
+    }
+
+    assert(sall(4));
+    assert(calls == 4);
+
+    calls = 0;
+    assert(!sall(2));
+    assert(calls == 3);
+
+    calls = 0;
+    assert(sany(1));
+    assert(calls == 2);
+
+    calls = 0;
+    assert(!sany(4));
+    assert(calls == 4);
+
+    // empty signals
+    sigslot::signal_r<bool(int), sigslot::combiner::all_of> eall;
+    sigslot::signal_r<bool(int), sigslot::combiner::any_of> eany;
+    assert(eall(1));
+    assert(!eany(1));
+}
+
+static void test_to_vector() {
+    sigslot::signal_r<std::string(const std::string &), sigslot::combiner::to_vector<std::string>> sig;
+    sig.connect([] (const std::string &s) { return s + "2"; }, 2);
+    sig.connect([] (const std::string &s) { return s + "1"; }, 1);
+
+    auto res = sig("a");
+    assert((res == std::vector<std::string>{"a1", "a2"}));
+}
+
+static void test_pmf_and_tracking() {
+    sigslot::signal_r<int(int), sigslot::combiner::sum<int>> sig;
+
+    o p;
+    sig.connect(&o::add, &p);
+    assert(sig(1) == 2);
+
+    auto s = std::make_shared<o>();
+    s->v = 10;
+    sig.connect(&o::add, s);
+    auto t = std::make_shared<int>(0);
+    sig.connect(twice, t);
+    assert(sig(1) == 15);
+    assert(sig.slot_count() == 3);
+
+    s.reset();
+    t.reset();
+    assert(sig(1) == 2);
+    assert(sig.slot_count() == 1);
+}
+
+static void test_connection_management() {
+    sigslot::signal_r<int(int), sigslot::combiner::sum<int>> sig;
+    auto c = sig.connect(twice);
+    sig.connect(twice, 1);
+    sig.connect(twice, 2);
+    assert(sig(1) == 6);
+
+    c.block();
+    assert(sig(1) == 4);
+    c.unblock();
+
+    c.disconnect();
+    assert(sig(1) == 4);
+
+    assert(sig.disconnect(1) == 1);
+    assert(sig(1) == 2);
+
+    sig.block();
+    assert(sig(1) == 0);
+    sig.unblock();
+
+    {
+        auto sc = sig.connect_scoped(twice);
+        assert(sig(1) == 4);
+    }
+    assert(sig(1) == 2);
+
+    sig.disconnect_all();
+    assert(sig(1) == 0);
+    assert(sig.slot_count() == 0);
+}
+
+static void test_single_threaded() {
+    sigslot::signal_r_st<int(int), sigslot::combiner::sum<int>> sig;
+    sig.connect(twice);
+    sig.connect(twice);
+    assert(sig(3) == 12);
+}
+
+int main() {
+    test_default_combiner();
+    test_sum();
+    test_min_max();
+    test_short_circuit();
+    test_to_vector();
+    test_pmf_and_tracking();
+    test_connection_management();
+    test_single_threaded();
+    return 0;
+}
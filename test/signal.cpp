@@ -4,6 +4,7 @@
 #include <sstream>
 #include <cassert>
 #include <cmath>
+#include <memory>
 
 static int sum = 0;
 
@@ -625,6 +626,30 @@ void test_connection_copying_moving() {
     assert(sum == 9);
 }
 
+void test_connection_outliving_signal() {
+    auto p = std::make_shared<int>(0);
+    sigslot::connection c1, c2;
+    sigslot::connection_blocker cb;
+
+    {
+        sigslot::signal<int> sig;
+        c1 = sig.connect([p] (int) {});
+        c2 = sig.connect_extended([p] (sigslot::connection &, int) {});
+        cb = c1.blocker();
+
+        assert(c1.valid() && c1.connected() && c1.blocked());
+        assert(c2.valid() && c2.connected());
+        assert(p.use_count() == 3);
+    }
+
+    // the callables are gone, but the connection objects remain usable
+    assert(p.use_count() == 1);
+    assert(!c1.valid() && !c1.connected());
+    assert(!c2.valid() && !c2.disconnect());
+    c1.unblock();
+    assert(!c1.blocked());
+}
+
 void test_scoped_connection_moving() {
     sum = 0;
     sigslot::signal<int> sig;
@@ -704,6 +729,27 @@ void test_loop() {
     assert(i2.val() == 1);
 }
 
+void test_destruction_in_slot() {
+    int i = 0;
+    auto sig = std::make_unique<sigslot::signal<>>();
+
+    sig->connect([&] { sig.reset(); });
+    sig->connect([&] { i++; });
+    (*sig)();
+    assert(!sig);
+
+    // with slots disconnected during the emission
+    sig = std::make_unique<sigslot::signal<>>();
+    auto c = sig->connect([&] { i++; });
+    sig->connect([&] {
+        c.disconnect();
+        sig.reset();
+    });
+    sig->connect([&] { i++; });
+    (*sig)();
+    assert(!sig);
+}
+
 int main() {
     test_free_connection();
     test_static_connection();
@@ -727,9 +773,11 @@ int main() {
     test_signal_blocking();
     test_all_disconnection();
     test_connection_copying_moving();
+    test_connection_outliving_signal();
     test_scoped_connection_moving();
     test_signal_moving();
     test_loop();
+    test_destruction_in_slot();
     test_slot_count();
     return 0;
 }
@@ -0,0 +1,241 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+// count the calls to the global allocator
+static std::atomic<std::size_t> allocations{0};
+
+void * operator new(std::size_t n) {
+    allocations++;
+    if (void *p = std::malloc(n ? n : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+static int sum = 0;
+
+static void f(int i) { sum += i; }
+
+template <typename Sig>
+static void test_churn_without_allocation() {
+    sum = 0;
+    Sig sig;
+
+    // warm up the pool and the slot list
+    for (int i = 0; i < 10; ++i) {
+        sigslot::scoped_connection c1 = sig.connect(f);
+        sigslot::scoped_connection c2 = sig.connect([] (int i) { sum += i; });
+    }
+
+    const auto before = allocations.load();
+    for (int i = 0; i < 1000; ++i) {
+        sigslot::scoped_connection c1 = sig.connect(f);
+        sigslot::scoped_connection c2 = sig.connect([] (int i) { sum += i; });
+        sig(1);
+    }
+
+    assert(allocations.load() == before);
+    assert(sum == 2000);
+}
+
+static void test_slot_list_copies() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    sigslot::connection c = sig.connect(f);
+    c.disconnect();
+
+    // the slot comes from the pool, and the list has room left, but is
+    // shared with the emission and thus gets copied
+    std::size_t during = 0;
+    sig.connect([&] (int) {
+        if (!c.valid()) {
+            const auto before = allocations.load();
+            c = sig.connect(f);
+            during = allocations.load() - before;
+        }
+    });
+    sig(1);
+    assert(during > 0);
+
+    // a list no emission shares is modified in place
+    c.disconnect();
+    const auto before = allocations.load();
+    c = sig.connect(f);
+    assert(allocations.load() == before);
+
+    // lists read without locking are copied by every modification
+    sigslot::signal_rcu<int> rcu;
+    rcu.connect(f).disconnect();
+    const auto rcu_before = allocations.load();
+    sigslot::scoped_connection rc = rcu.connect(f);
+    assert(allocations.load() > rcu_before);
+}
+
+static void test_large_slot() {
+    sum = 0;
+    sigslot::signal<int> sig;
+
+    std::array<int, 64> big{};
+    big[0] = 1;
+
+    // does not fit in a block, falls back to the global allocator
+    const auto before = allocations.load();
+    sigslot::scoped_connection c = sig.connect([big] (int i) { sum += big[0] * i; });
+    assert(allocations.load() > before);
+
+    sig(2);
+    assert(sum == 2);
+}
+
+static void test_over_aligned_slot() {
+    struct alignas(64) aligned {
+        int v;
+    };
+
+    sum = 0;
+    sigslot::signal<int> sig;
+    aligned a{3};
+    sigslot::scoped_connection c = sig.connect([a] (int i) {
+        assert(reinterpret_cast<std::uintptr_t>(&a) % 64 == 0);
+        sum += a.v * i;
+    });
+
+    sig(2);
+    assert(sum == 6);
+}
+
+static void test_slot_outlives_signal() {
+    sum = 0;
+    sigslot::connection c;
+
+    {
+        sigslot::signal<int> sig;
+        for (int i = 0; i < 100; ++i) {
+            sig.connect(f);
+        }
+        c = sig.connect(f);
+        sig(1);
+        assert(sum == 101);
+    }
+
+    // the pool is kept alive by the slot state the connection refers to
+    assert(!c.valid());
+}
+
+static void test_moved_signal() {
+    sum = 0;
+    sigslot::signal<int> sig1;
+    sig1.connect(f);
+
+    sigslot::signal<int> sig2 = std::move(sig1);
+    sig2.connect(f);
+    sig2(1);
+    assert(sum == 2);
+
+    sig1.connect(f);
+    sig1(1);
+    assert(sum == 3);
+}
+
+#ifdef SIGSLOT_PMR_ENABLED
+// a memory resource keeping track of its allocations
+struct counting_resource : std::pmr::memory_resource {
+    std::size_t allocations = 0;
+    std::size_t outstanding = 0;
+
+private:
+    void * do_allocate(std::size_t n, std::size_t align) override {
+        assert(align <= alignof(std::max_align_t));
+        allocations++;
+        outstanding++;
+        return std::malloc(n);
+    }
+
+    void do_deallocate(void *p, std::size_t, std::size_t) override {
+        outstanding--;
+        std::free(p);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &o) const noexcept override {
+        return this == &o;
+    }
+};
+
+static void test_memory_resource() {
+    sum = 0;
+    counting_resource res;
+
+    {
+        std::array<int, 64> big{};
+        big[0] = 1;
+
+        const auto before = allocations.load();
+        sigslot::signal<int> sig(&res);
+        auto c1 = sig.connect(f);
+        auto c2 = sig.connect([big] (int i) { sum += big[0] * i; }, 1);
+        sig(1);
+        c1.disconnect();
+        sig(1);
+        assert(sum == 3);
+
+        // the slots, slot lists and pool all come from the resource
+        assert(allocations.load() == before);
+        assert(res.allocations > 0);
+    }
+
+    assert(res.outstanding == 0);
+}
+
+template <typename Sig>
+static void test_memory_resource_release() {
+    sum = 0;
+    counting_resource res;
+
+    {
+        Sig sig(&res);
+        for (int i = 0; i < 100; ++i) {
+            sig.connect(f, i % 3);
+        }
+        sig(1);
+        sig.disconnect(1);
+        sig(1);
+        assert(sum == 167);
+    }
+
+    assert(res.allocations > 0);
+    assert(res.outstanding == 0);
+}
+#endif
+
+int main() {
+    test_churn_without_allocation<sigslot::signal_st<int>>();
+    test_churn_without_allocation<sigslot::signal<int>>();
+    test_slot_list_copies();
+    test_large_slot();
+    test_over_aligned_slot();
+    test_slot_outlives_signal();
+    test_moved_signal();
+#ifdef SIGSLOT_PMR_ENABLED
+    test_memory_resource();
+    test_memory_resource_release<sigslot::signal_st<int>>();
+    test_memory_resource_release<sigslot::signal<int>>();
+    test_memory_resource_release<sigslot::signal_rcu<int>>();
+    test_memory_resource_release<sigslot::signal_cached<int>>();
+#endif
+    return 0;
+}
@@ -63,8 +63,125 @@ static void test_disconnect_group() {
     assert(sum == 10);
 }
 
+static void remover(res_container &) {}
+
+static void test_mixed_disconnection() {
+    res_container results;
+    sigslot::signal<res_container&> sig;
+    std::vector<sigslot::connection> conns;
+
+    std::mt19937_64 gen{std::random_device()()};
+    std::uniform_int_distribution<sigslot::group_id> dist(-5, 5);
+
+    // interleave slots that will be disconnected in bulk with other ones
+    for (size_t i = 0; i < num_slots; ++i) {
+        auto gid = dist(gen);
+        conns.push_back(sig.connect(pusher(gid), gid));
+        sig.connect(remover, dist(gen));
+    }
+
+    assert(sig.disconnect(remover) == num_slots);
+    assert(sig.slot_count() == num_slots);
+
+    // slot indices must have been kept right for individual disconnection
+    for (size_t i = 0; i < num_slots; i += 2) {
+        assert(conns[i].disconnect());
+    }
+    assert(sig.slot_count() == num_slots / 2);
+
+    sig(results);
+    assert(results.size() == num_slots / 2);
+    assert(std::is_sorted(results.begin(), results.end()));
+}
+
+static void test_sparse_groups_churn() {
+    sigslot::signal<res_container&> sig;
+    std::vector<sigslot::connection> conns;
+
+    std::mt19937_64 gen{std::random_device()()};
+    std::uniform_int_distribution<sigslot::group_id> dist(-100000, 100000);
+
+    for (int round = 0; round < 10; ++round) {
+        for (size_t i = 0; i < num_slots; ++i) {
+            auto gid = dist(gen);
+            conns.push_back(sig.connect(pusher(gid), gid));
+        }
+
+        // empty groups, either by disconnecting them or all of their slots
+        for (size_t i = 0; i < conns.size(); i += 3) {
+            conns[i].disconnect();
+        }
+        for (int i = 0; i < 100; ++i) {
+            sig.disconnect(dist(gen));
+        }
+
+        res_container results;
+        sig(results);
+        assert(results.size() == sig.slot_count());
+        assert(std::is_sorted(results.begin(), results.end()));
+    }
+}
+
+static void test_random_disconnection() {
+    sigslot::signal<res_container&> sig;
+    std::vector<std::pair<sigslot::group_id, sigslot::connection>> conns;
+
+    std::mt19937_64 gen{std::random_device()()};
+    std::uniform_int_distribution<sigslot::group_id> dist(-10, 10);
+
+    for (size_t i = 0; i < num_slots; ++i) {
+        auto gid = dist(gen);
+        conns.emplace_back(gid, sig.connect(pusher(gid), gid));
+    }
+
+    // disconnecting a slot moves others around, which must stay reachable
+    std::shuffle(conns.begin(), conns.end(), gen);
+    for (size_t i = 0; i < num_slots / 2; ++i) {
+        assert(conns.back().second.disconnect());
+        conns.pop_back();
+        if (i % 50 == 0) {
+            auto gid = dist(gen);
+            conns.emplace_back(gid, sig.connect(pusher(gid), gid));
+            std::swap(conns.front(), conns.back());
+        }
+    }
+
+    res_container expected;
+    for (auto &c : conns) {
+        expected.push_back(c.first);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    res_container results;
+    sig(results);
+    assert(results == expected);
+}
+
+static void test_inplace_group_reuse() {
+    int sum = 0;
+    sigslot::inplace_signal<4, int&> sig;
+
+    // the groups left empty must not take up room
+    for (int round = 0; round < 10; ++round) {
+        std::vector<sigslot::connection> conns;
+        for (int i = 0; i < 4; ++i) {
+            conns.push_back(sig.connect(adder(1), round * 4 + i));
+            assert(conns.back().valid());
+        }
+        sig(sum);
+        for (auto &c : conns) {
+            c.disconnect();
+        }
+    }
+    assert(sum == 40);
+}
+
 int main() {
     test_random_groups();
     test_disconnect_group();
+    test_mixed_disconnection();
+    test_sparse_groups_churn();
+    test_random_disconnection();
+    test_inplace_group_reuse();
     return 0;
 }
@@ -0,0 +1,98 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <functional>
+#include <string>
+
+static int sum = 0;
+
+static void f1(int i) { sum += i; }
+static void f2(int i) { sum += 2*i; }
+
+struct o1 { void operator()(int i) { sum += 3*i; } };
+
+struct counter {
+    void operator()(int i) { count += i; }
+    int count = 0;
+};
+
+static void test_static_emission() {
+    sum = 0;
+    auto sig = sigslot::make_static_signal<int>(f1, &f2, o1{}, [] (int i) { sum += 4*i; });
+    static_assert(decltype(sig)::slot_count() == 4, "wrong slot count");
+
+    sig(1);
+    assert(sum == 10);
+
+    sig(2);
+    assert(sum == 30);
+}
+
+static void test_static_slot_access() {
+    auto sig = sigslot::make_static_signal<int>(counter{}, counter{});
+
+    sig(1);
+    sig(2);
+    assert(sig.slot<0>().count == 3);
+    assert(sig.slot<1>().count == 3);
+}
+
+static void test_static_slot_blocking() {
+    sum = 0;
+    auto sig = sigslot::make_static_signal<int>(f1, f2);
+
+    sig.block<1>();
+    assert(sig.blocked<1>());
+    assert(!sig.blocked<0>());
+    sig(1);
+    assert(sum == 1);
+
+    sig.unblock<1>();
+    sig(1);
+    assert(sum == 4);
+}
+
+static void test_static_signal_blocking() {
+    sum = 0;
+    auto sig = sigslot::make_static_signal<int>(f1, f2);
+
+    sig.block();
+    assert(sig.blocked());
+    sig(1);
+    assert(sum == 0);
+
+    sig.unblock();
+    sig(1);
+    assert(sum == 3);
+}
+
+static void test_static_arguments() {
+    std::string res;
+    auto sig = sigslot::make_static_signal<const std::string &, int>(
+        [&] (const std::string &s, int i) { res += s + std::to_string(i); },
+        [&] (std::string s, long i) { res += s + std::to_string(i + 1); });
+
+    sig("a", 1);
+    assert(res == "a1a2");
+}
+
+static void test_static_chaining() {
+    sum = 0;
+    sigslot::signal<int> sig;
+    sig.connect(f1);
+
+    // a static signal can forward to a dynamic one
+    auto ssig = sigslot::make_static_signal<int>(f2, std::ref(sig));
+    ssig(1);
+    assert(sum == 3);
+}
+
+int main() {
+    test_static_emission();
+    test_static_slot_access();
+    test_static_slot_blocking();
+    test_static_signal_blocking();
+    test_static_arguments();
+    test_static_chaining();
+    return 0;
+}
@@ -0,0 +1,194 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct s : sigslot::trackable {
+    void f1(int &i) { ++i; }
+    void f2(int &i) const { i += 2; }
+};
+
+// records calls made on a destroyed instance
+struct guarded : sigslot::trackable {
+    ~guarded() override {
+        this->expire();
+        alive.store(false);
+    }
+
+    void f(int) {
+        assert(alive.load());
+        calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<bool> alive{true};
+    static std::atomic<long> calls;
+};
+
+std::atomic<long> guarded::calls{0};
+
+template <template <typename...> class SIG_T>
+void test_trackable_pmf() {
+    int sum = 0;
+    SIG_T<int &> sig;
+
+    {
+        s p1;
+        sig.connect(&s::f1, &p1);
+        {
+            const s p2;
+            sig.connect(&s::f2, &p2);
+            assert(sig.slot_count() == 2);
+            sig(sum);
+            assert(sum == 3);
+        }
+
+        // automatic disconnection on destruction
+        assert(sig.slot_count() == 1);
+        sig(sum);
+        assert(sum == 4);
+    }
+
+    assert(sig.slot_count() == 0);
+    sig(sum);
+    assert(sum == 4);
+}
+
+template <template <typename...> class SIG_T>
+void test_trackable_callable() {
+    int sum = 0;
+    SIG_T<int &> sig;
+
+    {
+        auto p = std::make_unique<s>();
+        sig.connect([] (int &i) { i += 5; }, p.get());
+        sig(sum);
+        assert(sum == 5);
+
+        // disconnection by object
+        assert(sig.disconnect(p.get()) == 1);
+        sig(sum);
+        assert(sum == 5);
+
+        sig.connect([] (int &i) { i += 5; }, p.get());
+    }
+
+    assert(sig.slot_count() == 0);
+    sig(sum);
+    assert(sum == 5);
+}
+
+static void test_trackable_copy() {
+    int sum = 0;
+    sigslot::signal<int &> sig;
+
+    s p1;
+    sig.connect(&s::f1, &p1);
+    {
+        // connections are not copied
+        s p2 = p1;
+        assert(sig.slot_count() == 1);
+    }
+    assert(sig.slot_count() == 1);
+    sig(sum);
+    assert(sum == 1);
+}
+
+static void test_trackable_outliving_signal() {
+    s p;
+    {
+        sigslot::signal<int &> sig;
+        sig.connect(&s::f1, &p);
+    }
+}
+
+static void test_trackable_threaded() {
+    constexpr int objects = 200;
+    constexpr int threads = 4;
+    std::atomic<bool> done{false};
+    sigslot::signal<int> sig;
+
+    std::vector<std::thread> emitters;
+    for (int t = 0; t < threads; ++t) {
+        emitters.emplace_back([&] {
+            while (!done) {
+                sig(1);
+            }
+        });
+    }
+
+    for (int i = 0; i < objects; ++i) {
+        auto g = std::make_unique<guarded>();
+        sig.connect(&guarded::f, g.get());
+        std::this_thread::yield();
+    }
+
+    done = true;
+    for (auto &t : emitters) {
+        t.join();
+    }
+
+    assert(sig.slot_count() == 0);
+}
+
+static void test_trackable_independent_expiration() {
+    std::mutex m;
+    std::atomic<bool> entered{false};
+    sigslot::signal<int &> sig;
+    s p;
+    sig.connect([&] (int &) {
+        entered = true;
+        std::lock_guard<std::mutex> _{m};
+    }, &p);
+
+    std::unique_lock<std::mutex> lock(m);
+    std::thread emitter([&] {
+        int i = 0;
+        sig(i);
+    });
+    while (!entered) {
+        std::this_thread::yield();
+    }
+
+    // the slot running on the other thread does not track these objects
+    {
+        s unconnected;
+        s connected;
+        sig.connect(&s::f1, &connected);
+    }
+
+    lock.unlock();
+    emitter.join();
+}
+
+static void test_trackable_expiration_in_slot() {
+    int sum = 0;
+    sigslot::signal<int &> sig;
+    auto p = std::make_unique<s>();
+    sig.connect([&] (int &i) {
+        p.reset();
+        ++i;
+    }, p.get());
+
+    sig(sum);
+    assert(!p);
+    assert(sum == 1);
+    assert(sig.slot_count() == 0);
+}
+
+int main() {
+    test_trackable_pmf<sigslot::signal>();
+    test_trackable_pmf<sigslot::signal_st>();
+    test_trackable_pmf<sigslot::signal_rcu>();
+    test_trackable_callable<sigslot::signal>();
+    test_trackable_callable<sigslot::signal_st>();
+    test_trackable_copy();
+    test_trackable_outliving_signal();
+    test_trackable_threaded();
+    test_trackable_independent_expiration();
+    test_trackable_expiration_in_slot();
+    return 0;
+}